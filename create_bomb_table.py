@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Generate the bomb fall time table used by aimed bombing.
+
+Writes src/bomb_table.c and inc/bomb_table.h: for every height a plane can
+drop from, the number of ticks a bomb takes to come down to an igloo. It
+runs the same fix16 steps as updateBombs() (gravity, then the speed cap,
+then the move), with the constants read from inc/common.h, so the game only
+needs a table lookup to know where a bomb released now will land.
+
+Run from the project root: python3 create_bomb_table.py
+"""
+
+import re
+
+COMMON = 'inc/common.h'
+OUT_C = 'src/bomb_table.c'
+OUT_H = 'inc/bomb_table.h'
+
+FIX16_ONE = 64  # fix16 has 6 fractional bits
+
+
+def read_defines(path):
+    """Evaluate the simple numeric #defines in a header (FIX16() included)."""
+    exprs = {}
+    for line in open(path):
+        match = re.match(r'#define\s+(\w+)\s+([^/]+)', line)
+        if match and re.fullmatch(r'[\w\s.+\-*/()]+', match.group(2).strip()):
+            exprs[match.group(1)] = match.group(2).strip().replace('/', '//')
+
+    # Defines can use names defined further down, so keep going until stuck
+    values = {'FIX16': lambda value: int(value * FIX16_ONE)}  # C cast truncates
+    while exprs:
+        solved = {}
+        for name, expr in exprs.items():
+            try:
+                value = eval(expr, {'__builtins__': {}}, values)
+            except Exception:
+                continue
+            if isinstance(value, int):
+                solved[name] = value
+        if not solved:
+            break
+        values.update(solved)
+        for name in solved:
+            del exprs[name]
+    return values
+
+
+def fall_ticks(start_y, target_y, initial_vy, gravity, max_vy):
+    """Ticks until a bomb released at pixel height start_y reaches target_y."""
+    y = start_y * FIX16_ONE
+    vy = initial_vy
+    ticks = 0
+    while (y >> 6) < target_y:
+        vy = min(vy + gravity, max_vy)
+        y += vy
+        ticks += 1
+    return ticks
+
+
+def main():
+    defines = read_defines(COMMON)
+    target = defines['BOMB_AIM_Y']
+    ticks = [fall_ticks(y, target, defines['BOMB_INITIAL_VY'], defines['BOMB_GRAVITY'], defines['BOMB_MAX_VY'])
+             for y in range(target)]
+    if max(ticks) > 255:
+        raise ValueError(f'fall times up to {max(ticks)} ticks do not fit a u8')
+
+    with open(OUT_H, 'w') as f:
+        f.write(f'''// Generated by create_bomb_table.py from {COMMON} - do not edit
+#ifndef BOMB_TABLE_H
+#define BOMB_TABLE_H
+
+#include <genesis.h>
+
+// bomb_fall_ticks[y] is how many ticks a bomb dropped at pixel height y
+// takes to reach BOMB_AIM_Y. Heights from BOMB_FALL_TABLE_SIZE down are
+// already at the igloos.
+#define BOMB_FALL_TABLE_SIZE {len(ticks)}
+
+extern const u8 bomb_fall_ticks[BOMB_FALL_TABLE_SIZE];
+
+#endif // BOMB_TABLE_H
+''')
+
+    with open(OUT_C, 'w') as f:
+        f.write(f'// Generated by create_bomb_table.py from {COMMON} - do not edit\n')
+        f.write('#include "bomb_table.h"\n\n')
+        f.write('const u8 bomb_fall_ticks[BOMB_FALL_TABLE_SIZE] =\n{\n')
+        for start in range(0, len(ticks), 16):
+            f.write('    ' + ', '.join(str(t) for t in ticks[start:start + 16]) + ',  '
+                    f'// Y {start}-{min(start + 15, len(ticks) - 1)}\n')
+        f.write('};\n')
+    print(f'Created {OUT_C} (fall times for heights 0-{len(ticks) - 1}, {min(ticks)}-{max(ticks)} ticks)')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""
+Build the animated explosion sprite sheets from res/sprites/explosion.png.
+
+The source (also in explosion.aseprite) is a single 16x16 frame. This expands it
+into a 4 frame animation (flash, grow, full, fade), plus a 32x32 version of the
+same animation used when several explosions are merged into one.
+Frames are laid out left to right so rescomp reads them as one animation.
+
+Indexed color and the original palette are kept, so the sheets still use PAL2.
+Only the standard library is needed (no PIL).
+"""
+
+import struct
+import zlib
+
+SOURCE = 'res/sprites/explosion.png'
+SMALL_SHEET = 'res/sprites/explosion-sheet.png'
+BIG_SHEET = 'res/sprites/explosion-big-sheet.png'
+
+# Palette indexes used by the explosion art
+CORE_COLORS = (6, 7)  # Yellow / orange center
+
+
+def read_indexed_png(path):
+    """Return (width, height, rows, palette_chunk) for an 8-bit indexed PNG."""
+    data = open(path, 'rb').read()
+    pos = 8
+    idat = b''
+    plte = None
+    trns = None
+    while pos < len(data):
+        length, = struct.unpack('>I', data[pos:pos + 4])
+        kind = data[pos + 4:pos + 8]
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color_type = struct.unpack('>IIBB', chunk[:10])
+            if depth != 8 or color_type != 3:
+                raise ValueError(f'{path}: expected 8-bit indexed PNG')
+        elif kind == b'PLTE':
+            plte = chunk
+        elif kind == b'tRNS':
+            trns = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(width)
+    i = 0
+    for _ in range(height):
+        filter_type = raw[i]
+        line = bytearray(raw[i + 1:i + 1 + width])
+        i += 1 + width
+        for x in range(width):
+            a = line[x - 1] if x else 0
+            b = prev[x]
+            c = prev[x - 1] if x else 0
+            if filter_type == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif filter_type == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif filter_type == 3:
+                line[x] = (line[x] + (a + b) // 2) & 0xFF
+            elif filter_type == 4:
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + pred) & 0xFF
+        rows.append(list(line))
+        prev = line
+    return width, height, rows, plte, trns
+
+
+def write_indexed_png(path, rows, plte, trns):
+    height = len(rows)
+    width = len(rows[0])
+
+    def chunk(kind, body):
+        crc = zlib.crc32(kind + body) & 0xFFFFFFFF
+        return struct.pack('>I', len(body)) + kind + body + struct.pack('>I', crc)
+
+    raw = b''.join(b'\x00' + bytes(row) for row in rows)
+    png = b'\x89PNG\r\n\x1a\n'
+    png += chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 3, 0, 0, 0))
+    png += chunk(b'PLTE', plte)
+    if trns:
+        png += chunk(b'tRNS', trns)
+    png += chunk(b'IDAT', zlib.compress(raw, 9))
+    png += chunk(b'IEND', b'')
+    open(path, 'wb').write(png)
+
+
+def make_frames(base):
+    """Flash, grow, full and fade frames from the single base frame."""
+    size = len(base)
+    center = (size - 1) / 2.0
+
+    def radius(x, y):
+        return ((x - center) ** 2 + (y - center) ** 2) ** 0.5
+
+    flash = [[p if radius(x, y) <= 4 else 0 for x, p in enumerate(row)] for y, row in enumerate(base)]
+    grow = [[p if radius(x, y) <= 6 else 0 for x, p in enumerate(row)] for y, row in enumerate(base)]
+    full = [list(row) for row in base]
+    fade = [[0 if (p in CORE_COLORS and radius(x, y) <= 5) or (x + y) % 2 else p
+             for x, p in enumerate(row)] for y, row in enumerate(base)]
+    return [flash, grow, full, fade]
+
+
+def scale2x(frame):
+    out = []
+    for row in frame:
+        wide = [p for p in row for _ in range(2)]
+        out.append(wide)
+        out.append(list(wide))
+    return out
+
+
+def sheet(frames):
+    """Lay frames out left to right."""
+    return [sum((frame[y] for frame in frames), []) for y in range(len(frames[0]))]
+
+
+def main():
+    width, height, base, plte, trns = read_indexed_png(SOURCE)
+    if width != 16 or height != 16:
+        raise ValueError(f'{SOURCE}: expected a 16x16 frame')
+
+    frames = make_frames(base)
+    write_indexed_png(SMALL_SHEET, sheet(frames), plte, trns)
+    print(f'Created {SMALL_SHEET} ({len(frames)} frames of 16x16)')
+
+    big_frames = [scale2x(frame) for frame in frames]
+    write_indexed_png(BIG_SHEET, sheet(big_frames), plte, trns)
+    print(f'Created {BIG_SHEET} ({len(big_frames)} frames of 32x32)')
+
+
+if __name__ == '__main__':
+    main()
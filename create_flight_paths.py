@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""
+Bake the plane flight paths in data/paths.txt into ROM delta tables.
+
+Writes src/flight_paths.c (one table of per-tick Y steps per path) and
+inc/flight_paths.h. Steps are in fix16 units (1/64 pixel) and are worked out
+from the rounded height at every tick, so a path lands exactly where the
+data says however many steps it takes. In the game a step is one table read
+and one add: no trig or curve math at run time.
+
+Run from the project root: python3 create_flight_paths.py
+"""
+
+import math
+import re
+
+DATA = 'data/paths.txt'
+OUT_C = 'src/flight_paths.c'
+OUT_H = 'inc/flight_paths.h'
+
+FIX16_ONE = 64          # fix16 has 6 fractional bits
+MAX_PATHS = 8           # Waves select paths with a u8 bit mask
+SEGMENT_ARGS = {'hold': 1, 'line': 2, 'ease': 2, 'sine': 2}
+
+
+def read_paths(path):
+    """Return a list of (name, segments, loop_index) in file order."""
+    paths = []
+    for number, line in enumerate(open(path), 1):
+        line = line.split('#', 1)[0].strip()
+        if not line:
+            continue
+        parts = line.split()
+        kind = parts[0]
+        if kind == 'path':
+            if len(parts) != 2 or not re.fullmatch(r'[a-z_][a-z0-9_]*', parts[1]):
+                raise ValueError(f'{path}:{number}: expected "path name"')
+            if any(name == parts[1] for name, _, _ in paths):
+                raise ValueError(f'{path}:{number}: path "{parts[1]}" is defined twice')
+            paths.append((parts[1], [], None))
+            continue
+        if not paths:
+            raise ValueError(f'{path}:{number}: segment before the first "path" line')
+        name, segments, loop = paths[-1]
+        if kind == 'loop':
+            if loop is not None:
+                raise ValueError(f'{path}:{number}: path "{name}" has two loop points')
+            paths[-1] = (name, segments, len(segments))
+        elif kind in SEGMENT_ARGS:
+            if len(parts) != 1 + SEGMENT_ARGS[kind]:
+                raise ValueError(f'{path}:{number}: "{kind}" takes {SEGMENT_ARGS[kind]} value(s)')
+            values = [int(value) for value in parts[1:]]
+            if values[-1] <= 0:
+                raise ValueError(f'{path}:{number}: segment length must be positive')
+            segments.append((kind, values))
+        else:
+            raise ValueError(f'{path}:{number}: unknown segment "{kind}"')
+
+    if not paths:
+        raise ValueError(f'{path}: no paths defined')
+    if len(paths) > MAX_PATHS:
+        raise ValueError(f'{path}: at most {MAX_PATHS} paths')
+    return paths
+
+
+def read_path_names(path):
+    return [name for name, _, _ in read_paths(path)]
+
+
+def offsets(kind, values):
+    """Height (pixels) after each tick of one segment, relative to its start."""
+    ticks = values[-1]
+    for tick in range(1, ticks + 1):
+        t = tick / ticks
+        if kind == 'hold':
+            yield 0.0
+        elif kind == 'line':
+            yield values[0] * t
+        elif kind == 'ease':
+            yield values[0] * t * t * (3 - 2 * t)
+        elif kind == 'sine':
+            yield values[0] * math.sin(2 * math.pi * t)
+
+
+def bake(name, segments, loop):
+    """Return (steps, loop_step) for one path."""
+    steps = []
+    loop_step = 0
+    base = 0.0
+    last = 0
+    for index, (kind, values) in enumerate(segments):
+        if index == loop:
+            loop_step = len(steps)
+            loop_height = last
+        offset = 0.0
+        for offset in offsets(kind, values):
+            height = round((base + offset) * FIX16_ONE)
+            steps.append(height - last)
+            last = height
+        base += offset
+
+    if loop is None or loop == len(segments):
+        raise ValueError(f'{DATA}: path "{name}" needs a loop point before a segment')
+    if last != loop_height:
+        raise ValueError(f'{DATA}: path "{name}" ends {(last - loop_height) / FIX16_ONE:+g} pixels '
+                         f'from where its loop starts')
+    for step in steps:
+        if not -128 <= step <= 127:
+            raise ValueError(f'{DATA}: path "{name}" moves too fast ({step / FIX16_ONE:g} pixels per tick)')
+    return steps, loop_step
+
+
+def write_header(path, paths):
+    defines = ''.join(f'#define FLIGHT_PATH_{name.upper()} {index}\n' for index, (name, _, _) in enumerate(paths))
+    with open(path, 'w') as f:
+        f.write(f'''// Generated by create_flight_paths.py from {DATA} - do not edit
+#ifndef FLIGHT_PATHS_H
+#define FLIGHT_PATHS_H
+
+#include <genesis.h>
+
+// A plane steps its Y by deltas[step] every tick, then moves to the next
+// step; after the last one it goes back to step `loop`.
+typedef struct {{
+    const s8* deltas;   // Y change per tick, in fix16 units (1/64 pixel)
+    u16 length;
+    u16 loop;
+}} FlightPath;
+
+// Paths (index into flight_paths[], bit in WaveParams.paths)
+{defines}#define FLIGHT_PATH_COUNT {len(paths)}
+
+extern const FlightPath flight_paths[FLIGHT_PATH_COUNT];
+
+#endif // FLIGHT_PATHS_H
+''')
+
+
+def write_source(path, baked):
+    with open(path, 'w') as f:
+        f.write(f'// Generated by create_flight_paths.py from {DATA} - do not edit\n')
+        f.write('#include "flight_paths.h"\n')
+        for name, steps, _ in baked:
+            f.write(f'\nstatic const s8 path_{name}[{len(steps)}] =\n{{\n')
+            for start in range(0, len(steps), 16):
+                f.write('    ' + ', '.join(str(step) for step in steps[start:start + 16]) + ',\n')
+            f.write('};\n')
+        f.write('\nconst FlightPath flight_paths[FLIGHT_PATH_COUNT] =\n{\n')
+        for name, steps, loop_step in baked:
+            f.write(f'    {{ path_{name}, {len(steps)}, {loop_step} }},\n')
+        f.write('};\n')
+
+
+def main():
+    paths = read_paths(DATA)
+    baked = []
+    for name, segments, loop in paths:
+        steps, loop_step = bake(name, segments, loop)
+        baked.append((name, steps, loop_step))
+    write_header(OUT_H, paths)
+    write_source(OUT_C, baked)
+    total = sum(len(steps) for _, steps, _ in baked)
+    print(f'Created {OUT_C} ({len(baked)} paths, {total} bytes of steps)')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+Generate the snowball lead table used by the CPU partner (src/ai.c).
+
+Writes src/lead_table.c and inc/lead_table.h: for each distance from the
+cannon (in LEAD_BUCKET_SIZE pixel steps), how many ticks a normal snowball
+takes to get there and how far gravity has pulled it below its aim line by
+then. It runs the same fix16 steps as updateMissiles() (gravity, then the
+move), with the constants read from inc/common.h, so the AI leads a moving
+target with a lookup instead of solving the intercept every frame.
+
+Distances are the cheap max + min/2 estimate the AI uses, not true lengths.
+
+Run from the project root: python3 create_lead_table.py
+"""
+
+from create_bomb_table import read_defines, FIX16_ONE
+
+COMMON = 'inc/common.h'
+OUT_C = 'src/lead_table.c'
+OUT_H = 'inc/lead_table.h'
+
+BUCKET_SHIFT = 3  # 8 pixel distance steps
+
+
+def flight(distance, speed, gravity):
+    """(ticks, drop in pixels) for a snowball to travel distance pixels."""
+    travelled = 0
+    drop = 0
+    vy = 0
+    ticks = 0
+    while (travelled >> 6) < distance:
+        vy += gravity
+        drop += vy
+        travelled += speed
+        ticks += 1
+    return ticks, drop >> 6
+
+
+def main():
+    defines = read_defines(COMMON)
+
+    # Furthest the crosshair can be from the right cannon (player 2's)
+    max_dx = defines['CANNON_RIGHT_X'] - 16
+    max_dy = defines['CANNON_Y'] - 32
+    size = ((max(max_dx, max_dy) + min(max_dx, max_dy) // 2) >> BUCKET_SHIFT) + 1
+
+    bucket = 1 << BUCKET_SHIFT
+    table = [flight(b * bucket + bucket // 2, defines['MISSILE_SPEED'], defines['MISSILE_GRAVITY'])
+             for b in range(size)]
+    if max(max(entry) for entry in table) > 255:
+        raise ValueError('lead times or drops do not fit a u8')
+
+    with open(OUT_H, 'w') as f:
+        f.write(f'''// Generated by create_lead_table.py from {COMMON} - do not edit
+#ifndef LEAD_TABLE_H
+#define LEAD_TABLE_H
+
+#include <genesis.h>
+
+// For a target about d pixels from the cannon (max + min/2 of the x and y
+// distances), snowball_lead_ticks[d >> LEAD_BUCKET_SHIFT] is how many ticks a
+// normal snowball takes to reach it and snowball_lead_drop[] how many pixels
+// gravity has pulled it down by then. Fast snowballs take half the time and
+// don't drop.
+#define LEAD_BUCKET_SHIFT {BUCKET_SHIFT}
+#define LEAD_TABLE_SIZE {size}
+
+extern const u8 snowball_lead_ticks[LEAD_TABLE_SIZE];
+extern const u8 snowball_lead_drop[LEAD_TABLE_SIZE];
+
+#endif // LEAD_TABLE_H
+''')
+
+    def write_array(f, name, values):
+        f.write(f'const u8 {name}[LEAD_TABLE_SIZE] =\n{{\n')
+        for start in range(0, len(values), 16):
+            end = min(start + 15, len(values) - 1)
+            f.write('    ' + ', '.join(str(v) for v in values[start:start + 16]) + ',  '
+                    f'// {start * bucket}-{end * bucket + bucket - 1} px\n')
+        f.write('};\n')
+
+    with open(OUT_C, 'w') as f:
+        f.write(f'// Generated by create_lead_table.py from {COMMON} - do not edit\n')
+        f.write('#include "lead_table.h"\n\n')
+        write_array(f, 'snowball_lead_ticks', [ticks for ticks, _ in table])
+        f.write('\n')
+        write_array(f, 'snowball_lead_drop', [drop for _, drop in table])
+    print(f'Created {OUT_C} (lead for distances 0-{size * bucket - 1} px, up to {table[-1][0]} ticks)')
+
+
+if __name__ == '__main__':
+    main()
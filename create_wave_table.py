@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+Generate the wave parameter table from data/waves.txt.
+
+Writes src/wave_table.c (one WaveParams record per wave, in ROM) and
+inc/wave_table.h. Once every setting has stopped changing (including the
+bomb drop chance reaching its cap) the waves only differ by which of them get
+a truck or polar bear, which repeats every lcm(truck_every, bear_every) waves.
+The table ends after one such period and later waves loop over it.
+
+Bomb drops are scheduled rather than rolled every tick: the gap between a
+plane's drops is geometric with the wave's per-tick chance p, sampled as
+floor(-ln(u) / -ln(1 - p)) + 1 ticks. The wave table stores 1 / -ln(1 - p)
+(Q4) and drop_gap_neglog[] holds -ln(u) (Q8) for 256 evenly spaced u, so
+the game needs one random byte, one multiply and one shift per drop.
+
+Run from the project root: python3 create_wave_table.py
+"""
+
+import math
+import re
+
+from create_flight_paths import read_path_names
+
+DATA = 'data/waves.txt'
+PATHS_DATA = 'data/paths.txt'
+OUT_C = 'src/wave_table.c'
+OUT_H = 'inc/wave_table.h'
+
+KEYS = ('planes', 'large', 'speed', 'drop_step', 'drop_cap', 'truck_every', 'bear_every', 'aimed', 'paths')
+DROP_GAP_TABLE_SIZE = 256
+
+LIMITS = {'planes': 7, 'large': 5}  # Together they fill MAX_ENEMIES (12)
+
+
+def read_changes(path, path_names):
+    """Return a sorted list of (wave, {key: value}) from the data file."""
+    changes = []
+    for number, line in enumerate(open(path), 1):
+        line = line.split('#', 1)[0].strip()
+        if not line:
+            continue
+        parts = line.split()
+        wave = int(parts[0])
+        settings = {}
+        for part in parts[1:]:
+            match = re.fullmatch(r'(\w+)=([\w.+]+)', part)
+            if not match or match.group(1) not in KEYS:
+                raise ValueError(f'{path}:{number}: bad setting "{part}"')
+            key, value = match.groups()
+            if key == 'paths':
+                names = value.split('+')
+                for name in names:
+                    if name not in path_names:
+                        raise ValueError(f'{path}:{number}: unknown flight path "{name}" (see {PATHS_DATA})')
+                settings[key] = tuple(sorted(set(names), key=path_names.index))
+                continue
+            if not re.fullmatch(r'[\d.]+', value):
+                raise ValueError(f'{path}:{number}: bad setting "{part}"')
+            settings[key] = value if key == 'speed' else int(value)
+            if key in LIMITS and settings[key] > LIMITS[key]:
+                raise ValueError(f'{path}:{number}: {key} is limited to {LIMITS[key]}')
+        changes.append((wave, settings))
+
+    changes.sort(key=lambda change: change[0])
+    if not changes or changes[0][0] != 1 or set(changes[0][1]) != set(KEYS):
+        raise ValueError(f'{path}: the first line must be wave 1 and set every value')
+    return changes
+
+
+def build_table(changes):
+    # Wave from which nothing but the truck/bear rhythm changes any more
+    final = {}
+    for _, settings in changes:
+        final.update(settings)
+    loop_start = changes[-1][0]
+    if final['drop_step']:
+        loop_start = max(loop_start, math.ceil(final['drop_cap'] / final['drop_step']))
+
+    period = math.lcm(final['truck_every'] or 1, final['bear_every'] or 1)
+    last_wave = loop_start + period - 1
+
+    waves = []
+    current = {}
+    pending = list(changes)
+    for wave in range(1, last_wave + 1):
+        while pending and pending[0][0] <= wave:
+            current.update(pending.pop(0)[1])
+        drop = min(current['drop_step'] * wave, current['drop_cap'])
+        flags = []
+        if current['truck_every'] and wave % current['truck_every'] == 0:
+            flags.append('WAVE_FLAG_TRUCK')
+        if current['bear_every'] and wave % current['bear_every'] == 0:
+            flags.append('WAVE_FLAG_BEAR')
+        if current['aimed']:
+            flags.append('WAVE_FLAG_AIMED')
+        waves.append((wave, current['planes'], current['large'], current['speed'], drop, flags, current['paths']))
+    return waves, loop_start, period
+
+
+def drop_scale(per_mille):
+    """Q4 mean of -ln(u) scaled to a geometric gap for this drop chance (0 = never)."""
+    if per_mille == 0:
+        return 0
+    if per_mille >= 1000:
+        raise ValueError(f'{DATA}: drop chance must stay below 1000 per mille')
+    return round(16 / -math.log(1 - per_mille / 1000))
+
+
+def drop_gap_neglog():
+    """-ln(u) in Q8 at the middle of each of the 256 steps of u."""
+    return [round(-math.log((i + 0.5) / DROP_GAP_TABLE_SIZE) * 256) for i in range(DROP_GAP_TABLE_SIZE)]
+
+
+def write_header(path, count, loop_start, period):
+    with open(path, 'w') as f:
+        f.write(f'''// Generated by create_wave_table.py from {DATA} - do not edit
+#ifndef WAVE_TABLE_H
+#define WAVE_TABLE_H
+
+#include <genesis.h>
+
+// Wave flags
+#define WAVE_FLAG_TRUCK 0x01  // Powerup truck appears this wave
+#define WAVE_FLAG_BEAR  0x02  // Polar bear appears this wave
+#define WAVE_FLAG_AIMED 0x04  // Planes aim their bombs at igloos instead of dropping at random
+
+typedef struct {{
+    u8 planes;          // Small planes
+    u8 large_planes;    // Large planes
+    fix16 speed;        // Base plane speed
+    u16 drop_scale;     // Scales drop_gap_neglog[] into ticks between bomb drops, Q4 (0 = none)
+    u8 flags;           // WAVE_FLAG_*
+    u8 paths;           // Flight paths planes can be given, one bit per FLIGHT_PATH_*
+}} WaveParams;
+
+// wave_table[0] is wave 1. Waves past the end repeat the last
+// WAVE_TABLE_LOOP_LENGTH entries, starting from WAVE_TABLE_LOOP_START.
+#define WAVE_TABLE_LENGTH {count}
+#define WAVE_TABLE_LOOP_START {loop_start}
+#define WAVE_TABLE_LOOP_LENGTH {period}
+
+extern const WaveParams wave_table[WAVE_TABLE_LENGTH];
+
+// -ln(u) in Q8 for u evenly spread over (0, 1). The ticks from one bomb
+// drop to the next are ((drop_gap_neglog[r] * drop_scale) >> 12) + 1 for a
+// random byte r, a geometric gap with the wave's per-tick drop chance.
+#define DROP_GAP_TABLE_SIZE {DROP_GAP_TABLE_SIZE}
+
+extern const u16 drop_gap_neglog[DROP_GAP_TABLE_SIZE];
+
+#endif // WAVE_TABLE_H
+''')
+
+
+def write_source(path, waves):
+    with open(path, 'w') as f:
+        f.write(f'// Generated by create_wave_table.py from {DATA} - do not edit\n')
+        f.write('#include "wave_table.h"\n')
+        f.write('#include "flight_paths.h"\n\n')
+        f.write('const WaveParams wave_table[WAVE_TABLE_LENGTH] =\n{\n')
+        for wave, planes, large, speed, drop, flags, paths in waves:
+            flag_text = ' | '.join(flags) if flags else '0'
+            path_text = ' | '.join(f'(1 << FLIGHT_PATH_{name.upper()})' for name in paths)
+            f.write(f'    {{ {planes}, {large}, FIX16({speed}), {drop_scale(drop)}, {flag_text}, {path_text} }},'
+                    f'  // Wave {wave}, drop chance {drop}/1000\n')
+        f.write('};\n')
+
+        f.write('\nconst u16 drop_gap_neglog[DROP_GAP_TABLE_SIZE] =\n{\n')
+        neglog = drop_gap_neglog()
+        for start in range(0, len(neglog), 16):
+            f.write('    ' + ', '.join(str(value) for value in neglog[start:start + 16]) + ',\n')
+        f.write('};\n')
+
+
+def main():
+    changes = read_changes(DATA, read_path_names(PATHS_DATA))
+    waves, loop_start, period = build_table(changes)
+    write_header(OUT_H, len(waves), loop_start, period)
+    write_source(OUT_C, waves)
+    print(f'Created {OUT_C} ({len(waves)} waves, looping {period} waves from wave {loop_start})')
+
+
+if __name__ == '__main__':
+    main()
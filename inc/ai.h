@@ -0,0 +1,37 @@
+#ifndef AI_H
+#define AI_H
+
+#include "common.h"
+
+// CPU partner for "1P + CPU". It plays player 2 through a virtual pad, so
+// the crosshair speed and limits, ammo and cannon rules are the same as for
+// a person. Built to fit the frame budget:
+// - threats are scanned a few pool entries per frame, and the best one seen
+//   over a full pass of the bomb and plane pools becomes the next target
+// - the flight time used to lead a moving target comes from the snowball
+//   lead table (lead_table.h) instead of being solved every tick
+// - the scan stops early once it has used AI_SCAN_MAX_LINES in a frame
+#define AI_TARGET_NONE 0
+#define AI_TARGET_BOMB 1
+#define AI_TARGET_PLANE 2
+
+#define AI_SCAN_PER_FRAME 8   // Pool entries looked at per frame (a full pass takes 6 frames)
+#define AI_SCAN_CHECK 4       // Entries between scanline checks
+#define AI_SCAN_MAX_LINES 6   // Most scanlines the scan may take in a frame
+
+#define AI_SCORE_THREAT 512   // Bombs that will land on a living igloo (plus height: lowest first)
+#define AI_SCORE_PLANE 256    // Planes, when no igloo is in danger (plus height)
+#define AI_IGLOO_RADIUS 12    // Landing this close to an igloo hits it (as checkCollisions)
+#define AI_MAX_AIM_Y (CANNON_Y - 8)  // Lowest point the crosshair aims at (no shots below the cannons)
+
+#define AI_FIRE_RADIUS 4      // Crosshair this close to the intercept point fires
+#define AI_FAST_RADIUS 24     // Further away than this, hold B to move at double speed
+#define AI_FIRE_COOLDOWN 12   // Ticks between shots
+#define AI_SHOT_MARGIN 8      // Extra ticks a bomb that was shot at is left alone
+
+// Functions
+void initAI();
+void updateAI();
+void driveAI();
+
+#endif // AI_H
@@ -0,0 +1,14 @@
+#ifndef BCD_H
+#define BCD_H
+
+#include "common.h"
+
+// Packed BCD helpers: one decimal digit per nibble, so 0x1250 means 1250.
+// Packed BCD values compare correctly as plain unsigned integers.
+
+// Functions
+u32 bcdAdd(u32 a, u32 b);
+u16 bcdDecrement(u16 value);
+u8 bcdFromByte(u8 value);
+
+#endif // BCD_H
@@ -0,0 +1,14 @@
+// Generated by create_bomb_table.py from inc/common.h - do not edit
+#ifndef BOMB_TABLE_H
+#define BOMB_TABLE_H
+
+#include <genesis.h>
+
+// bomb_fall_ticks[y] is how many ticks a bomb dropped at pixel height y
+// takes to reach BOMB_AIM_Y. Heights from BOMB_FALL_TABLE_SIZE down are
+// already at the igloos.
+#define BOMB_FALL_TABLE_SIZE 165
+
+extern const u8 bomb_fall_ticks[BOMB_FALL_TABLE_SIZE];
+
+#endif // BOMB_TABLE_H
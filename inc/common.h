@@ -2,6 +2,7 @@
 #define COMMON_H
 
 #include <genesis.h>
+#include "flight_paths.h"
 
 // Screen constants
 #define SCREEN_WIDTH    320
@@ -12,32 +13,61 @@
 #define CROSSHAIR_SPEED_BOOST   4
 
 // Missile constants
-#define MAX_MISSILES 30
+#define MAX_MISSILES 48
 #define MISSILE_SPEED FIX16(3)
 #define MISSILE_GRAVITY FIX16(0.02)
 #define MISSILE_TYPE_NORMAL 0
 #define MISSILE_TYPE_FAST 1
 
 // Enemy constants
-#define MAX_ENEMIES 7
-#define MAX_LARGE_ENEMIES 5
-#define ENEMY_SPEED FIX16(0.3)
-#define LARGE_ENEMY_HURT_DURATION 10  // Frames to show hurt sprite (1/6 second at 60fps)
+#define MAX_ENEMIES 12  // Shared by every plane type (a wave has at most 7 small + 5 large)
+#define ENEMY_HURT_DURATION 10  // Frames to show hurt sprite (1/6 second at 60fps)
+#define MISSILE_HIT_MARGIN 4  // Half the 8px snowball, added to a plane's half extents
+
+// Plane types (index into enemy_types[])
+#define ENEMY_TYPE_SMALL 0
+#define ENEMY_TYPE_LARGE 1
+#define ENEMY_TYPE_COUNT 2
 #define ENEMY_MIN_SPACING 40  // Minimum pixels between enemies when spawning
 
+// Spawn slots: a checkerboard of lanes (Y) and entry offsets (pixels off-screen)
+// on each side. Lanes and offsets are half the minimum spacing apart, and only
+// every other cell is used, so any two slots are at least ENEMY_MIN_SPACING apart.
+#define SPAWN_GRID_STEP (ENEMY_MIN_SPACING / 2)
+#define SPAWN_LANE_TOP 16     // Y of the first lane
+#define SPAWN_LANES 6         // Lanes at Y 16, 36 ... 116
+#define SPAWN_OFFSET_FIRST 20 // Nearest entry offset off-screen
+#define SPAWN_COLUMNS 4       // Entry offsets 20, 40, 60, 80
+#define SPAWN_SLOTS (SPAWN_LANES * SPAWN_COLUMNS)  // Both sides, half the cells each
+#define WAVE_ENTRY_INTERVAL 0  // Ticks between planned plane entries (0 = all at once)
+#define WAVE_ACTIVATIONS_PER_TICK 2  // Planes activated (given sprites) per tick at most
+
 // Bomb constants
-#define MAX_BOMBS 20
+#define MAX_BOMBS 32
 #define BOMB_INITIAL_VY FIX16(0.05)
 #define BOMB_GRAVITY FIX16(0.02)
 #define BOMB_MAX_VY FIX16(0.8)
 #define BOMB_BLAST_RADIUS 32
 #define BOMB_BLAST_FORCE FIX16(3.0)
 #define BOMB_CHAIN_RADIUS 5
-#define BOMB_DROP_CHANCE 1
+#define BOMB_AIM_Y (CANNON_Y - 11)  // First height at which a bomb hits an igloo
+#define BOMB_AIM_TOLERANCE 2  // Aimed planes release when the landing point is this close to an igloo
+#define NO_AIM_TARGET 0xFF
+#define DROP_UNSCHEDULED 0  // Enemy.next_drop before the plane's first tick on screen
+
+// Projectile layer (snowballs and bombs are drawn as BG_B tiles, not sprites)
+#define PROJ_LAYER_COLS (SCREEN_WIDTH / 8)
+#define PROJ_LAYER_ROWS (SCREEN_HEIGHT / 8)
+#define PROJ_MAX_TILES 160  // RAM/VRAM tiles available to the layer each frame
+#define TILE_PROJECTILE_INDEX TILE_USER_INDEX  // First VRAM tile reserved for the layer
 
 // Igloo constants
 #define NUM_IGLOOS 5
 
+// Igloo and cannon tiles (drawn on BG_A, loaded after the projectile layer tiles)
+#define TILE_IGLOO_INDEX (TILE_PROJECTILE_INDEX + PROJ_MAX_TILES)
+#define TILE_CANNON_INDEX (TILE_IGLOO_INDEX + 4)
+
 // Cannon positions
 #define CANNON_LEFT_X  32
 #define CANNON_RIGHT_X (SCREEN_WIDTH - 32)
@@ -55,11 +85,23 @@
 #define POLAR_BEAR_SPEED_BOOST FIX16(0.6)  // Speed boost per click (same as base speed)
 #define POLAR_BEAR_MAX_CLICKS 3  // Max clicks that give speed boost
 #define POLAR_BEAR_Y (SCREEN_HEIGHT - 32)  // Y position
-#define POLAR_BEAR_BASE_SCORE 200  // First click score
+#define POLAR_BEAR_BASE_SCORE 0x200  // First click score (BCD)
+
+// Score awards (packed BCD, see bcd.h)
+#define SCORE_PLANE             0x100
+#define SCORE_LARGE_PLANE       0x200
+#define SCORE_BOMB              0x10
+#define SCORE_PLANE_BLAST       0x50   // Half points when a blast wave finishes a plane
+#define SCORE_LARGE_PLANE_BLAST 0x100
 
 // Explosion constants
 #define MAX_EXPLOSIONS 10
 #define EXPLOSION_DURATION 15  // Frames to show explosion (0.25 seconds at 60fps)
+#define EXPLOSION_FRAME_SHIFT 2  // Animation frame = frames elapsed >> 2 (4 frames)
+#define EXPLOSION_STATIC_FRAME 2  // Frame shown when the governor turns animation off (full)
+#define EXPLOSION_MERGE_RADIUS 24  // Manhattan distance for merging explosion requests
+#define EXPLOSION_MERGE_AGE 2  // Only explosions at most this many frames old absorb new ones
+#define TILE_EXPLOSION_INDEX (TILE_CANNON_INDEX + 4)  // Preloaded explosion frames (small then big)
 
 // Powerup constants
 #define TRIPLE_SHOT_DURATION 1800  // 30 seconds at 60fps
@@ -75,17 +117,40 @@ typedef struct {
     u8 active;
     u8 player;
     u8 type;  // MISSILE_TYPE_NORMAL or MISSILE_TYPE_FAST
-    Sprite* sprite;
 } Missile;
 
-// Enemy structure
+// Constant-speed horizontal motion, evaluated on demand (see motion.h)
 typedef struct {
-    fix16 x, y;
+    fix16 x0;        // X at start_tick
     fix16 vx;
-    u8 active;
+    s16 exit_x;      // Pixel X the entity leaves the screen past
+    u32 start_tick;  // game_ticks when the motion started (or last changed speed)
+    u32 exit_tick;   // First tick past exit_x
+} LinearMotion;
+
+// Plane type descriptor, kept in ROM (enemy_types[] in enemies.c)
+typedef struct {
+    const SpriteDefinition* sprite_def;
+    const SpriteDefinition* hurt_def;  // Shown while hurt_timer runs, NULL if the type has none
+    s16 half_width, half_height;       // Half the sprite size, centered on the plane position
+    s8 hp;
+    u32 score;        // Packed BCD, for a missile or megabomb kill
+    u32 blast_score;  // Packed BCD, when a blast wave finishes the plane
+} EnemyType;
+
+// Enemy structure (enemies[] is dense: the first enemy_count entries are in play)
+typedef struct {
+    const EnemyType* type;
+    LinearMotion motion;  // X comes from getMotionX()
+    fix16 y;
+    const FlightPath* path;  // Y follows the path's baked steps
+    u16 path_step;           // Next step in path->deltas
+    u8 aim_igloo;            // Igloo last aimed at (NO_AIM_TARGET if none)
+    u32 next_drop;           // game_ticks of the next random bomb drop (DROP_UNSCHEDULED until on screen)
     u8 from_left;
     s8 hp;
-    u8 hurt_timer;  // Frames to show hurt sprite (for large enemies)
+    u8 hurt_timer;  // Frames to show hurt sprite
+    s16 draw_x, draw_y;  // Last pixel position written to the sprite
     Sprite* sprite;
 } Enemy;
 
@@ -94,26 +159,26 @@ typedef struct {
     fix16 x, y;
     fix16 vx, vy;
     u8 active;
-    Sprite* sprite;
+    u8 half_rate;  // Throttled for the current tick pair (see throttle.h)
 } Bomb;
 
 // Igloo structure
 typedef struct {
     s16 x, y;
     u8 alive;
-    Sprite* sprite;
 } Igloo;
 
 // Powerup truck structure
 typedef struct {
-    fix16 x, y;
-    fix16 vx;
+    LinearMotion motion;  // X comes from getMotionX()
+    fix16 y;
     u8 active;
     u8 from_left;
     u8 spawn_pending;  // TRUE if truck should spawn after delay
     u16 spawn_timer;   // Frames until spawn (60 fps)
-    Sprite* sprite;
-    Sprite* arrow_sprite;  // Arrow powerup indicator
+    Sprite* sprite;        // Only while on screen
+    Sprite* arrow_sprite;  // Arrow powerup indicator (only while on screen)
+    u8 arrow_active;       // TRUE while the arrow is shown (riding the truck or rising)
     u8 arrow_collected;    // TRUE if arrow has been clicked/collected
     fix16 arrow_x;         // X position of arrow (when collected, stays fixed)
     fix16 arrow_y;         // Y position of arrow (when collected and moving upward)
@@ -124,13 +189,14 @@ typedef struct {
 
 // Polar bear structure
 typedef struct {
-    fix16 x, y;
-    fix16 vx;
+    LinearMotion motion;  // X comes from getMotionX(); clicks change the speed
+    fix16 y;
     u8 active;
     u8 from_left;
     u8 spawn_pending;
     u16 spawn_timer;
     u8 click_count;  // Number of times clicked this appearance
+    s16 draw_x;      // Last pixel X written to the sprite
     Sprite* sprite;
 } PolarBear;
 
@@ -139,24 +205,27 @@ typedef struct {
     s16 x, y;
     u8 active;
     u8 timer;  // Frames remaining before removal
+    u8 frame;  // Animation frame currently shown
+    u8 big;    // TRUE once other explosions have been merged into this one
     Sprite* sprite;
 } Explosion;
 
 // Global game state (extern declarations)
 extern u8 two_player_mode;
+extern u8 cpu_player2;  // Player 2 is driven by the CPU partner (ai.h)
 extern u16 current_wave;
 extern u8 enemies_spawned;
-extern u8 large_enemies_spawned;
 extern u8 wave_complete;
 extern u8 game_over;
 extern u8 game_paused;
-extern u32 score_p1;
+extern u8 title_screen_active;
+extern u32 score_p1;  // Scores and ammo are packed BCD
 extern u32 score_p2;
 extern u16 ammo_p1;
 extern u16 ammo_p2;
 extern u16 megabombs;
 extern u8 bonus_igloos_queued;
-extern u32 next_bonus_threshold;
+extern u32 next_bonus_threshold;  // Packed BCD
 extern u8 triple_shot_active_p1;
 extern u16 triple_shot_timer_p1;
 extern u8 triple_shot_active_p2;
@@ -169,7 +238,7 @@ extern u16 fast_shot_timer_p2;
 // Global object pools (extern declarations)
 extern Missile missiles[MAX_MISSILES];
 extern Enemy enemies[MAX_ENEMIES];
-extern Enemy large_enemies[MAX_LARGE_ENEMIES];
+extern u8 enemy_count;
 extern Bomb bombs[MAX_BOMBS];
 extern Igloo igloos[NUM_IGLOOS];
 extern PowerupTruck powerup_truck;
@@ -2,18 +2,23 @@
 #define ENEMIES_H
 
 #include "common.h"
+#include "wave_table.h"
+
+// Plane type descriptors (indexed by ENEMY_TYPE_*)
+extern const EnemyType enemy_types[ENEMY_TYPE_COUNT];
+
+// Parameters of the wave in play (loaded by spawnWave())
+extern WaveParams wave_params;
 
 // Functions
 void initEnemies();
 void spawnWave();
+void updateWaveEntries();
 void updateEnemies();
-void updateLargeEnemies();
+void destroyEnemy(u8 i);
 void updateBombs();
-fix16 getEnemySpeedForWave(u16 wave);
-u8 shouldSpawnTruck(u16 wave);
 void spawnPowerupTruck();
 void updatePowerupTruck();
-u8 shouldSpawnPolarBear(u16 wave);
 void spawnPolarBear();
 void updatePolarBear();
 void applyBlastWave(s16 bx, s16 by, u8 player);
@@ -7,5 +7,6 @@
 void initExplosions();
 void updateExplosions();
 void spawnExplosion(s16 x, s16 y);
+void spawnCosmeticExplosion(s16 x, s16 y);
 
 #endif // EXPLOSIONS_H
@@ -0,0 +1,24 @@
+// Generated by create_flight_paths.py from data/paths.txt - do not edit
+#ifndef FLIGHT_PATHS_H
+#define FLIGHT_PATHS_H
+
+#include <genesis.h>
+
+// A plane steps its Y by deltas[step] every tick, then moves to the next
+// step; after the last one it goes back to step `loop`.
+typedef struct {
+    const s8* deltas;   // Y change per tick, in fix16 units (1/64 pixel)
+    u16 length;
+    u16 loop;
+} FlightPath;
+
+// Paths (index into flight_paths[], bit in WaveParams.paths)
+#define FLIGHT_PATH_LEVEL 0
+#define FLIGHT_PATH_WEAVE 1
+#define FLIGHT_PATH_SWOOP 2
+#define FLIGHT_PATH_DIVE 3
+#define FLIGHT_PATH_COUNT 4
+
+extern const FlightPath flight_paths[FLIGHT_PATH_COUNT];
+
+#endif // FLIGHT_PATHS_H
@@ -0,0 +1,31 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+#include "common.h"
+
+// Quality governor. Watches how many scanlines each frame's game logic takes
+// and, when that stays high, steps down through quality levels that trade
+// eye candy for speed. Each level keeps the savings of the ones below it.
+// Levels are restored one at a time once the load has stayed low for a while.
+#define GOVERNOR_FULL 0                 // Everything on
+#define GOVERNOR_SLOW_HUD 1             // HUD text refreshed every GOVERNOR_HUD_INTERVAL frames
+#define GOVERNOR_NO_COSMETIC 2          // Cosmetic explosions (ground hits, megabomb debris) skipped
+#define GOVERNOR_STATIC_EXPLOSIONS 3    // Explosions show a single frame instead of animating
+#define GOVERNOR_SHORT_CHAINS 4         // Blast wave chain reactions capped at GOVERNOR_MAX_CHAIN_DEPTH
+#define GOVERNOR_LEVELS 5
+
+#define GOVERNOR_HIGH_LINES 160  // Logic scanlines that count as a heavy frame
+#define GOVERNOR_LOW_LINES 96    // Logic scanlines that count as a light frame
+#define GOVERNOR_RAISE_FRAMES 8  // Heavy frames in a row before dropping a level of quality
+#define GOVERNOR_LOWER_FRAMES 60 // Light frames in a row before restoring one
+
+#define GOVERNOR_HUD_INTERVAL 4     // Frames between HUD refreshes at GOVERNOR_SLOW_HUD
+#define GOVERNOR_MAX_CHAIN_DEPTH 2  // Blast waves that can set off further bombs, at GOVERNOR_SHORT_CHAINS
+
+extern u8 governor_level;
+
+// Functions
+void initGovernor();
+void updateGovernor();
+
+#endif // GOVERNOR_H
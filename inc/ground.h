@@ -0,0 +1,12 @@
+#ifndef GROUND_H
+#define GROUND_H
+
+#include "common.h"
+
+// Functions
+void initGroundTiles();
+void drawIgloo(u8 index);
+void clearIgloo(u8 index);
+void drawCannons();
+
+#endif // GROUND_H
@@ -0,0 +1,24 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "common.h"
+
+// Pad state for one player, sampled once per logic tick
+typedef struct {
+    u16 held;      // Buttons down this tick
+    u16 pressed;   // Buttons that went down since the last tick
+    u16 released;  // Buttons that went up since the last tick
+} PadState;
+
+#define NUM_PADS 2
+
+// pads[0] = player 1 (JOY_1), pads[1] = player 2 (JOY_2)
+extern PadState pads[NUM_PADS];
+
+// Functions
+void initInput();
+void updateInput();
+void setVirtualPad(u8 pad, u16 held);
+void releaseVirtualPad(u8 pad);
+
+#endif // INPUT_H
@@ -0,0 +1,30 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include "common.h"
+
+// Cooperative queue for work that doesn't have to finish in the frame it's
+// posted: jobs run at the end of the frame while there are scanlines to spare
+// before VBlank, highest priority first and in posting order within a
+// priority. A job that has waited max_delay frames runs regardless of time.
+
+#define MAX_JOBS 8
+#define JOB_MIN_LINES 24  // Spare scanlines needed before starting a job
+
+// Priorities (lower runs first)
+#define JOB_PRIORITY_HIGH 0
+#define JOB_PRIORITY_NORMAL 1
+#define JOB_PRIORITY_LOW 2
+
+// Frames a job can wait before it's forced to run
+#define JOB_DELAY_GAME 8  // Scoring, bonus igloos, wave setup
+#define JOB_DELAY_HUD 4   // HUD text
+
+typedef void (*JobFunc)();
+
+// Functions
+void initJobs();
+void postJob(JobFunc func, u8 priority, u16 max_delay);
+void runJobs();
+
+#endif // JOBS_H
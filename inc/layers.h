@@ -0,0 +1,19 @@
+#ifndef LAYERS_H
+#define LAYERS_H
+
+#include "common.h"
+
+// Render layers, front to back
+#define LAYER_HUD       0  // Crosshairs
+#define LAYER_EFFECTS   1  // Explosions, truck arrow
+#define LAYER_PLANES    2  // Small and large planes
+#define LAYER_GROUND    3  // Truck, polar bear
+#define NUM_LAYERS      4
+
+// Functions
+Sprite* addLayerSprite(const SpriteDefinition* def, s16 x, s16 y, u16 attr, u8 layer);
+Sprite* addLayerSpriteEx(const SpriteDefinition* def, s16 x, s16 y, u16 attr, u16 flags, u8 layer);
+void releaseLayerSprite(Sprite** sprite);
+u8 isBoxOnScreen(s16 x, s16 y, s16 width, s16 height);
+
+#endif // LAYERS_H
@@ -0,0 +1,18 @@
+// Generated by create_lead_table.py from inc/common.h - do not edit
+#ifndef LEAD_TABLE_H
+#define LEAD_TABLE_H
+
+#include <genesis.h>
+
+// For a target about d pixels from the cannon (max + min/2 of the x and y
+// distances), snowball_lead_ticks[d >> LEAD_BUCKET_SHIFT] is how many ticks a
+// normal snowball takes to reach it and snowball_lead_drop[] how many pixels
+// gravity has pulled it down by then. Fast snowballs take half the time and
+// don't drop.
+#define LEAD_BUCKET_SHIFT 3
+#define LEAD_TABLE_SIZE 44
+
+extern const u8 snowball_lead_ticks[LEAD_TABLE_SIZE];
+extern const u8 snowball_lead_drop[LEAD_TABLE_SIZE];
+
+#endif // LEAD_TABLE_H
@@ -0,0 +1,20 @@
+#ifndef MOTION_H
+#define MOTION_H
+
+#include "common.h"
+
+// Straight-line motion at a constant speed. Instead of stepping X every tick,
+// an entity keeps where and when it started and works out its position from
+// game_ticks when something needs it. The tick at which it passes exit_x is
+// worked out once at start (and again when its speed changes), so leaving the
+// screen is a single compare against game_ticks.
+
+#define MOTION_NEVER 0xFFFFFFFF  // exit_tick of something that isn't moving
+
+// Functions
+void startMotion(LinearMotion* motion, fix16 x, fix16 vx, s16 exit_x);
+void setMotionVelocity(LinearMotion* motion, fix16 vx);
+fix16 getMotionX(const LinearMotion* motion);
+u8 hasMotionExited(const LinearMotion* motion);
+
+#endif // MOTION_H
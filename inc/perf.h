@@ -0,0 +1,23 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include "common.h"
+
+// Overlay rows (below the ground so they never cover igloos or cannons)
+#define PERF_OVERLAY_ROW 25
+#define PERF_OVERLAY_REFRESH 8  // Frames between overlay text updates
+
+extern u8 perf_overlay_visible;
+extern u16 perf_logic_lines;   // Scanlines used by the last frame's game logic
+extern u16 perf_frame_lines;   // Scanlines used by the whole frame before VBlank wait
+extern u8 perf_frame_load;     // perf_frame_lines as a percentage of the frame's budget
+extern u32 perf_lag_frames;    // Frames where VBlank processing started late
+
+// Functions
+void perfFrameStart();
+void perfLogicEnd();
+void perfFrameEnd();
+u16 getFrameLinesLeft();
+void togglePerfOverlay();
+
+#endif // PERF_H
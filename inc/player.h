@@ -13,14 +13,6 @@ extern s16 crosshair2_y;
 extern Sprite* crosshair1_sprite;
 extern Sprite* crosshair2_sprite;
 
-// Cannon sprites
-extern Sprite* cannon_left_sprite;
-extern Sprite* cannon_right_sprite;
-
-// Previous button states (for edge detection)
-extern u16 prev_joy1;
-extern u16 prev_joy2;
-
 // Functions
 void initPlayer();
 void updateCrosshair();
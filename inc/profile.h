@@ -0,0 +1,49 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "common.h"
+
+// Scoped profiler
+//
+// PROF_BEGIN(id) / PROF_END(id) measure the scanlines spent inside a scope.
+// They compile to nothing unless the build defines PROFILE (make PROFILE=1).
+// Costs are summed per frame (nested or recursive entries of the same scope
+// only count the outermost one) and reduced to min/avg/max over a window of
+// PROFILE_WINDOW frames, which is logged to the emulator debug channel and
+// shown on the profiler page (hold A and press C while paused).
+
+// Profiled scopes
+#define PROF_CHECK_COLLISIONS 0
+#define PROF_BLAST_WAVE 1
+#define PROF_FIRE_MISSILE 2
+#define PROF_SPAWN_WAVE 3
+#define PROF_UPDATE_ENEMIES 4
+#define PROF_PROJECTILE_LAYER 5
+#define PROF_DRAW_HUD 6
+#define PROF_SPRITE_UPDATE 7
+#define PROF_SCOPES 8
+
+#define PROFILE_WINDOW 60     // Frames per min/avg/max window
+#define PROFILE_PAGE_ROW 5    // First text row of the profiler page
+
+#ifdef PROFILE
+
+#define PROF_BEGIN(id) profBegin(id)
+#define PROF_END(id) profEnd(id)
+#define PROF_FRAME_END() profFrameEnd()
+
+// Functions
+void profBegin(u8 id);
+void profEnd(u8 id);
+void profFrameEnd();
+void toggleProfilePage();
+
+#else
+
+#define PROF_BEGIN(id)
+#define PROF_END(id)
+#define PROF_FRAME_END()
+
+#endif // PROFILE
+
+#endif // PROFILE_H
@@ -0,0 +1,13 @@
+#ifndef PROJECTILES_H
+#define PROJECTILES_H
+
+#include "common.h"
+
+extern u16 projectile_tiles_used;
+extern u16 projectile_tile_overflows;
+
+// Functions
+void initProjectileLayer();
+void updateProjectileLayer();
+
+#endif // PROJECTILES_H
@@ -4,6 +4,7 @@
 #include "common.h"
 
 // Functions
+void addScore(u8 player, u32 points);
 void checkBonusIgloo();
 void checkGameOver();
 void restoreBonusIgloo();
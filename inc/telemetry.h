@@ -0,0 +1,114 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "common.h"
+
+// Frame telemetry ring buffer
+//
+// One record per frame is written into a RAM ring buffer so a RAM dump or
+// save state can be decoded on the host (see telemetry_decode.py). Nothing is
+// sent anywhere at runtime, so recording doesn't change frame timing beyond a
+// few V-counter reads.
+//
+// Layout (big-endian, as in 68000 RAM; the buffer is the `telemetry` symbol
+// in out/symbol.txt and starts with the magic "ICTL"):
+//
+//   Header (16 bytes)
+//     0  char[4]  magic "ICTL"
+//     4  u16      version (TELEMETRY_VERSION)
+//     6  u16      record size in bytes (44)
+//     8  u16      record count (TELEMETRY_RECORDS)
+//    10  u16      next record to write
+//    12  u32      total frames recorded
+//
+//   Record (44 bytes)
+//     0  u16      frame number (low 16 bits)
+//     2  u16      wave
+//     4  u8       active missiles
+//     5  u8       active small planes
+//     6  u8       active large planes
+//     7  u8       active bombs
+//     8  u8       active explosions
+//     9  u8       active hardware sprites
+//    10  u8       allocation failures this frame
+//    11  u8       flags (TELEMETRY_FLAG_*)
+//    12  u8       logic ticks run this frame
+//    13  u8[9]    VBlanks passed between the START mark and each mark
+//    22  u16[9]   V-counter at each phase mark (TELEMETRY_PHASE_*),
+//                 0xFFFF if the phase didn't run this frame
+//    40  u16      DMA bytes queued for the next VBlank
+//    42  u16      projectile layer tiles used
+//
+//   The V-counter wraps every frame, so a frame that overruns is measured
+//   with the VBlank counts: a mark is that many whole frames past its line.
+//   Marks inside the logic ticks are taken on the frame's first tick only;
+//   the catch-up ticks after it are timed by the LOGIC mark.
+//
+//   Version 2: marks 5 and 6 are RENDER and JOBS (were HUD and SPRITES),
+//   flag 0x10 is THROTTLED and flag bits 5-7 hold the governor level.
+//   Version 3: tick count, per-mark VBlank counts and the LOGIC mark added.
+
+#define TELEMETRY_MAGIC "ICTL"
+#define TELEMETRY_VERSION 3   // Bump whenever a field, mark or flag changes meaning
+#define TELEMETRY_RECORDS 128   // Power of 2 (5.5KB of records)
+#define TELEMETRY_NO_MARK 0xFFFF
+
+// Phase marks, in main loop order
+#define TELEMETRY_PHASE_START 0       // Top of the main loop (after VBlank)
+#define TELEMETRY_PHASE_MISSILES 1    // After updateMissiles() (first tick)
+#define TELEMETRY_PHASE_ENEMIES 2     // After updateEnemies() (first tick)
+#define TELEMETRY_PHASE_BOMBS 3       // After updateBombs() (first tick)
+#define TELEMETRY_PHASE_COLLISIONS 4  // After checkCollisions() (first tick)
+#define TELEMETRY_PHASE_LOGIC 5       // After the last logic tick (catch-up ticks)
+#define TELEMETRY_PHASE_RENDER 6      // After updateProjectileLayer() and SPR_update()
+#define TELEMETRY_PHASE_JOBS 7        // After runJobs() (HUD and deferred work)
+#define TELEMETRY_PHASE_END 8         // Before SYS_doVBlankProcess()
+#define TELEMETRY_PHASES 9
+
+// Record flags
+#define TELEMETRY_FLAG_PAUSED 0x01
+#define TELEMETRY_FLAG_GAME_OVER 0x02
+#define TELEMETRY_FLAG_TITLE 0x04
+#define TELEMETRY_FLAG_PAL 0x08
+#define TELEMETRY_FLAG_THROTTLED 0x10  // Low-priority updates ran at half rate
+#define TELEMETRY_GOVERNOR_SHIFT 5      // Bits 5-7 of the flags: quality governor level
+
+typedef struct {
+    u16 frame;
+    u16 wave;
+    u8 missiles;
+    u8 enemies;
+    u8 large_enemies;
+    u8 bombs;
+    u8 explosions;
+    u8 sprites;
+    u8 alloc_failures;
+    u8 flags;
+    u8 ticks;
+    u8 mark_vblanks[TELEMETRY_PHASES];
+    u16 marks[TELEMETRY_PHASES];
+    u16 dma_bytes;
+    u16 projectile_tiles;
+} TelemetryRecord;
+
+typedef struct {
+    char magic[4];
+    u16 version;
+    u16 record_size;
+    u16 record_count;
+    u16 head;
+    u32 frames;
+    TelemetryRecord records[TELEMETRY_RECORDS];
+} TelemetryBuffer;
+
+extern TelemetryBuffer telemetry;
+
+// Functions
+void initTelemetry();
+void telemetryFrameStart();
+void telemetryMark(u8 phase);
+void telemetryLogicEnd(u8 ticks);
+void telemetryAllocFailed();
+void telemetryFrameEnd();
+
+#endif // TELEMETRY_H
@@ -0,0 +1,16 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include "common.h"
+
+// Text layer size in cells (covers the visible part of BG_A)
+#define TEXT_COLS (SCREEN_WIDTH / 8)
+#define TEXT_ROWS (SCREEN_HEIGHT / 8)
+
+// Functions
+void resetTextLayer();
+void putText(const char* str, u16 x, u16 y);
+void putBCD(u32 value, u8 digits, u16 x, u16 y);
+void flushText();
+
+#endif // TEXT_H
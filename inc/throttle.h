@@ -0,0 +1,25 @@
+#ifndef THROTTLE_H
+#define THROTTLE_H
+
+#include "common.h"
+
+// Half-rate updates for low-priority work under load. When the last frame
+// used most of its budget, explosion timers, bombs high above the igloos or
+// off screen, and the rising powerup arrow only update every other tick,
+// taking a double step so they keep the same speed. Entities alternate by
+// index, so half of them update on each tick. Snowballs, planes and bombs
+// near the igloos always run at full rate. Steps are paired over ticks
+// (even, odd), and half rate only switches on or off between pairs.
+
+#define THROTTLE_ON_LOAD 95   // Last frame's load (% of budget) that turns half rate on
+#define THROTTLE_OFF_LOAD 80  // Load it has to drop below to turn off again
+#define THROTTLE_BOMB_Y (CANNON_Y - 64)  // Bombs above this can't reach an igloo in one double step
+
+extern u8 throttle_active;
+
+// Functions
+void updateThrottle();
+void syncThrottle();
+u8 getThrottleStep(u8 index);
+
+#endif // THROTTLE_H
@@ -0,0 +1,20 @@
+#ifndef TIMESTEP_H
+#define TIMESTEP_H
+
+#include "common.h"
+
+// Game logic runs at a fixed 60 ticks per second on both NTSC and PAL.
+// Time is kept in units of 1/300 second, which divides evenly into both
+// the VBlank rate (60 or 50 Hz) and the tick rate.
+#define TIMESTEP_UNITS_PER_SECOND 300
+#define TICK_RATE 60
+#define TICK_UNITS (TIMESTEP_UNITS_PER_SECOND / TICK_RATE)
+#define MAX_CATCHUP_TICKS 4  // Ticks run in one frame at most; time past this is dropped
+
+extern u32 game_ticks;  // Logic ticks run since the game started
+
+// Functions
+void initTimestep();
+u8 getPendingTicks();
+
+#endif // TIMESTEP_H
@@ -0,0 +1,36 @@
+// Generated by create_wave_table.py from data/waves.txt - do not edit
+#ifndef WAVE_TABLE_H
+#define WAVE_TABLE_H
+
+#include <genesis.h>
+
+// Wave flags
+#define WAVE_FLAG_TRUCK 0x01  // Powerup truck appears this wave
+#define WAVE_FLAG_BEAR  0x02  // Polar bear appears this wave
+#define WAVE_FLAG_AIMED 0x04  // Planes aim their bombs at igloos instead of dropping at random
+
+typedef struct {
+    u8 planes;          // Small planes
+    u8 large_planes;    // Large planes
+    fix16 speed;        // Base plane speed
+    u16 drop_scale;     // Scales drop_gap_neglog[] into ticks between bomb drops, Q4 (0 = none)
+    u8 flags;           // WAVE_FLAG_*
+    u8 paths;           // Flight paths planes can be given, one bit per FLIGHT_PATH_*
+} WaveParams;
+
+// wave_table[0] is wave 1. Waves past the end repeat the last
+// WAVE_TABLE_LOOP_LENGTH entries, starting from WAVE_TABLE_LOOP_START.
+#define WAVE_TABLE_LENGTH 319
+#define WAVE_TABLE_LOOP_START 300
+#define WAVE_TABLE_LOOP_LENGTH 20
+
+extern const WaveParams wave_table[WAVE_TABLE_LENGTH];
+
+// -ln(u) in Q8 for u evenly spread over (0, 1). The ticks from one bomb
+// drop to the next are ((drop_gap_neglog[r] * drop_scale) >> 12) + 1 for a
+// random byte r, a geometric gap with the wave's per-tick drop chance.
+#define DROP_GAP_TABLE_SIZE 256
+
+extern const u16 drop_gap_neglog[DROP_GAP_TABLE_SIZE];
+
+#endif // WAVE_TABLE_H
@@ -7,11 +7,8 @@
 # Crosshair is 16x16 (2x2 tiles)
 SPRITE sprite_crosshair "sprites/crosshair.png" 2 2 FAST 0
 
-# Cannon is 16x16 (2x2 tiles)
-SPRITE sprite_cannon "sprites/cannon.png" 2 2 FAST 0
-
-# Snowball missile is 8x8 (1x1 tile)
-SPRITE sprite_snowball "sprites/snowball.png" 1 1 FAST 0
+# Cannon is 16x16 (2x2 tiles) - drawn as background tiles, no map optimization
+IMAGE image_cannon "sprites/cannon.png" NONE NONE
 
 # Enemy plane is 24x16 (3x2 tiles)
 SPRITE sprite_plane "sprites/sm-enemy.png" 3 2 FAST 0
@@ -22,11 +19,11 @@ SPRITE sprite_plane_large "sprites/enemy-lg.png" 5 3 FAST 0
 # Large enemy plane hurt state is 40x24 (5x3 tiles)
 SPRITE sprite_plane_large_hurt "sprites/enemy-lg-hurt.png" 5 3 FAST 0
 
-# Bomb is 8x16 (1x2 tiles)
-SPRITE sprite_bomb "sprites/bomb-new-bigger.png" 1 2 FAST 0
+# Snowballs (sprites/snowball.png) and bombs (sprites/bomb-new-bigger.png) are not
+# sprites: their pixels are baked into src/projectiles.c and drawn on BG_B
 
-# Igloo is 16x16 (2x2 tiles) - reusing cannon sprite for now
-SPRITE sprite_igloo "sprites/cannon.png" 2 2 FAST 0
+# Igloo is 16x16 (2x2 tiles) - reusing cannon image for now, drawn as background tiles
+IMAGE image_igloo "sprites/cannon.png" NONE NONE
 
 # Polar bear is 24x16 (3x2 tiles) - using actual sprite
 SPRITE sprite_polarbear "sprites/polarbear.png" 3 2 FAST 0
@@ -37,8 +34,12 @@ SPRITE sprite_truck "sprites/bonus-truck-sheet.png" 3 3 FAST 2
 # Bonus arrow is 24x24 (3x3 tiles) - appears on truck
 SPRITE sprite_truck_arrow "sprites/bonus-arrow.png" 3 3 FAST 0
 
-# Explosion is 16x16 (2x2 tiles)
-SPRITE sprite_explosion "sprites/explosion.png" 2 2 FAST 0
+# Explosion is 16x16 (2x2 tiles) - 4 frame animation built by create_explosion_sheet.py
+# Timer 0: frames are stepped by updateExplosions() from tiles preloaded in VRAM
+SPRITE sprite_explosion "sprites/explosion-sheet.png" 2 2 FAST 0
+
+# Merged explosion is 32x32 (4x4 tiles) - same animation scaled 2x
+SPRITE sprite_explosion_big "sprites/explosion-big-sheet.png" 4 4 FAST 0
 
 # Music
 XGM bgm_music "music/test.vgm" -1
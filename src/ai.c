@@ -0,0 +1,238 @@
+#include "ai.h"
+#include "input.h"
+#include "player.h"
+#include "perf.h"
+#include "motion.h"
+#include "timestep.h"
+#include "bomb_table.h"
+#include "lead_table.h"
+
+// Scan order: every bomb slot, then every plane slot
+#define AI_SCAN_ENTRIES (MAX_BOMBS + MAX_ENEMIES)
+
+// Target the crosshair is working on
+static u8 target_kind = AI_TARGET_NONE;
+static u8 target_index = 0;
+
+// Threat scan in progress, and the worst threat it has found so far
+static u8 scan_next = 0;
+static u8 best_kind = AI_TARGET_NONE;
+static u8 best_index = 0;
+static u16 best_score = 0;
+
+static u8 fire_cooldown = 0;
+static u16 last_held = 0;
+
+// Last bomb shot at, left alone while the snowball is on its way
+static u8 shot_bomb = 0xFF;
+static u32 shot_until = 0;
+
+void initAI()
+{
+    target_kind = AI_TARGET_NONE;
+    scan_next = 0;
+    best_kind = AI_TARGET_NONE;
+    best_score = 0;
+    fire_cooldown = 0;
+    last_held = 0;
+    shot_bomb = 0xFF;
+    shot_until = 0;
+
+    // Player 2's pad only reports what the AI presses
+    if (cpu_player2)
+        setVirtualPad(1, 0);
+    else
+        releaseVirtualPad(1);
+}
+
+// Bombs only matter if they will land on a living igloo; the lower the bomb,
+// the more urgent. Landing X uses the aimed bombing fall table.
+static u16 scoreBomb(u8 i)
+{
+    if (!bombs[i].active || (i == shot_bomb && game_ticks < shot_until))
+        return 0;
+
+    s16 by = (s16)(bombs[i].y >> FIX16_FRAC_BITS);
+    if (by >= AI_MAX_AIM_Y)
+        return 0;  // Too low to shoot at
+
+    s16 landing_x = (s16)(bombs[i].x >> FIX16_FRAC_BITS);
+    if (bombs[i].vx != 0 && by >= 0 && by < BOMB_FALL_TABLE_SIZE)
+        landing_x += (s16)(((s32)bombs[i].vx * bomb_fall_ticks[by]) >> FIX16_FRAC_BITS);
+
+    for (u8 j = 0; j < NUM_IGLOOS; j++)
+    {
+        if (igloos[j].alive && abs(landing_x - igloos[j].x) < AI_IGLOO_RADIUS)
+            return AI_SCORE_THREAT + (by > 0 ? by : 0);
+    }
+    return 0;
+}
+
+// Planes on screen, lowest first
+static u16 scorePlane(u8 i)
+{
+    if (i >= enemy_count)
+        return 0;
+
+    s16 x = (s16)(getMotionX(&enemies[i].motion) >> FIX16_FRAC_BITS);
+    s16 y = (s16)(enemies[i].y >> FIX16_FRAC_BITS);
+    if (x < 16 || x > SCREEN_WIDTH - 16 || y < 0)
+        return 0;
+
+    return AI_SCORE_PLANE + y;
+}
+
+// Once per frame, before the logic ticks: score the next few pool entries,
+// and at the end of each pass switch to the worst threat it found
+void updateAI()
+{
+    if (!cpu_player2 || game_paused || game_over)
+        return;
+
+    // Nothing to spare in a frame that is already over budget
+    u16 start_left = getFrameLinesLeft();
+    if (start_left < AI_SCAN_MAX_LINES)
+        return;
+
+    for (u8 n = 0; n < AI_SCAN_PER_FRAME; n++)
+    {
+        // Hard cap on the scan's share of the frame
+        if (n && !(n & (AI_SCAN_CHECK - 1)) &&
+            start_left - getFrameLinesLeft() >= AI_SCAN_MAX_LINES)
+            break;
+
+        u8 kind, index;
+        u16 score;
+        if (scan_next < MAX_BOMBS)
+        {
+            kind = AI_TARGET_BOMB;
+            index = scan_next;
+            score = scoreBomb(index);
+        }
+        else
+        {
+            kind = AI_TARGET_PLANE;
+            index = scan_next - MAX_BOMBS;
+            score = scorePlane(index);
+        }
+
+        if (score > best_score)
+        {
+            best_kind = kind;
+            best_index = index;
+            best_score = score;
+        }
+
+        if (++scan_next == AI_SCAN_ENTRIES)
+        {
+            target_kind = best_kind;
+            target_index = best_index;
+            scan_next = 0;
+            best_kind = AI_TARGET_NONE;
+            best_score = 0;
+        }
+    }
+}
+
+// Position and speed of the current target (FALSE once it is gone)
+static u8 getTarget(fix16* x, fix16* y, fix16* vx, fix16* vy)
+{
+    if (target_kind == AI_TARGET_BOMB && bombs[target_index].active)
+    {
+        *x = bombs[target_index].x;
+        *y = bombs[target_index].y;
+        *vx = bombs[target_index].vx;
+        *vy = bombs[target_index].vy;
+        return TRUE;
+    }
+
+    if (target_kind == AI_TARGET_PLANE && target_index < enemy_count)
+    {
+        // Flight paths only nudge Y, so planes are led horizontally
+        *x = getMotionX(&enemies[target_index].motion);
+        *y = enemies[target_index].y;
+        *vx = enemies[target_index].motion.vx;
+        *vy = 0;
+        return TRUE;
+    }
+
+    target_kind = AI_TARGET_NONE;
+    return FALSE;
+}
+
+// Every tick, before updateInput(): steer player 2's crosshair to where the
+// target will be when a snowball gets there, and fire once it is on the spot
+void driveAI()
+{
+    if (!cpu_player2)
+        return;
+
+    u16 held = 0;
+    fix16 x, y, vx, vy;
+
+    if (!game_paused && fire_cooldown)
+        fire_cooldown--;
+
+    if (!game_paused && getTarget(&x, &y, &vx, &vy))
+    {
+        s16 tx = (s16)(x >> FIX16_FRAC_BITS);
+        s16 ty = (s16)(y >> FIX16_FRAC_BITS);
+
+        // Snowball flight time and drop from the lead table
+        s16 dx = abs(tx - CANNON_RIGHT_X);
+        s16 dy = abs(ty - CANNON_Y);
+        u16 bucket = ((dx > dy) ? dx + (dy >> 1) : dy + (dx >> 1)) >> LEAD_BUCKET_SHIFT;
+        if (bucket >= LEAD_TABLE_SIZE)
+            bucket = LEAD_TABLE_SIZE - 1;
+        u8 ticks = snowball_lead_ticks[bucket];
+        u8 drop = snowball_lead_drop[bucket];
+        if (fast_shot_active_p2)
+        {
+            ticks >>= 1;
+            drop = 0;
+        }
+
+        // Intercept point, raised by the drop so the snowball falls onto it
+        s16 aim_x = tx + (s16)(((s32)vx * ticks) >> FIX16_FRAC_BITS);
+        s16 aim_y = ty + (s16)(((s32)vy * ticks) >> FIX16_FRAC_BITS) - drop;
+        if (aim_x < 16)
+            aim_x = 16;
+        if (aim_x > SCREEN_WIDTH - 16)
+            aim_x = SCREEN_WIDTH - 16;
+        if (aim_y < 32)
+            aim_y = 32;
+        if (aim_y > AI_MAX_AIM_Y)
+            aim_y = AI_MAX_AIM_Y;
+
+        s16 ex = aim_x - crosshair2_x;
+        s16 ey = aim_y - crosshair2_y;
+        if (ex < -AI_FIRE_RADIUS)
+            held |= BUTTON_LEFT;
+        else if (ex > AI_FIRE_RADIUS)
+            held |= BUTTON_RIGHT;
+        if (ey < -AI_FIRE_RADIUS)
+            held |= BUTTON_UP;
+        else if (ey > AI_FIRE_RADIUS)
+            held |= BUTTON_DOWN;
+
+        if (abs(ex) > AI_FAST_RADIUS || abs(ey) > AI_FAST_RADIUS)
+        {
+            held |= BUTTON_B;
+        }
+        else if (held == 0 && fire_cooldown == 0 && ammo_p2 != 0 && !(last_held & BUTTON_A))
+        {
+            // On the spot: fire (A has to come up between shots to count as a press)
+            held |= BUTTON_A;
+            fire_cooldown = AI_FIRE_COOLDOWN;
+            if (target_kind == AI_TARGET_BOMB)
+            {
+                shot_bomb = target_index;
+                shot_until = game_ticks + ticks + AI_SHOT_MARGIN;
+            }
+            target_kind = AI_TARGET_NONE;
+        }
+    }
+
+    last_held = held;
+    setVirtualPad(1, held);
+}
@@ -0,0 +1,39 @@
+#include "bcd.h"
+
+// Add two 8 digit packed BCD numbers without any division or per-digit loop.
+// Every digit is pre-biased by 6 so a decimal carry becomes a binary carry,
+// then the bias is taken back out of the digits that did not carry.
+// (Same result as a chain of 68000 ABCD instructions.)
+u32 bcdAdd(u32 a, u32 b)
+{
+    u32 t1 = a + 0x06666666;
+    u32 t2 = t1 + b;
+    u32 carries = ~(t2 ^ t1 ^ b) & 0x11111110;
+    return t2 - ((carries >> 2) | (carries >> 3));
+}
+
+// Subtract one from a 4 digit packed BCD number (must not be zero)
+u16 bcdDecrement(u16 value)
+{
+    for (u16 shift = 0; shift < 16; shift += 4)
+    {
+        if ((value >> shift) & 0xF)
+            return value - (1 << shift);
+
+        // This digit is 0: it becomes 9 and the borrow moves to the next one
+        value |= 9 << shift;
+    }
+    return value;
+}
+
+// Convert a small binary number (0-99) to packed BCD
+u8 bcdFromByte(u8 value)
+{
+    u8 tens = 0;
+    while (value >= 10)
+    {
+        value -= 10;
+        tens++;
+    }
+    return (tens << 4) | value;
+}
@@ -0,0 +1,17 @@
+// Generated by create_bomb_table.py from inc/common.h - do not edit
+#include "bomb_table.h"
+
+const u8 bomb_fall_ticks[BOMB_FALL_TABLE_SIZE] =
+{
+    230, 228, 227, 226, 225, 223, 222, 221, 220, 218, 217, 216, 215, 213, 212, 211,  // Y 0-15
+    210, 208, 207, 206, 205, 203, 202, 201, 200, 198, 197, 196, 195, 193, 192, 191,  // Y 16-31
+    190, 188, 187, 186, 184, 183, 182, 181, 179, 178, 177, 176, 174, 173, 172, 171,  // Y 32-47
+    169, 168, 167, 166, 164, 163, 162, 161, 159, 158, 157, 156, 154, 153, 152, 151,  // Y 48-63
+    149, 148, 147, 146, 144, 143, 142, 141, 139, 138, 137, 136, 134, 133, 132, 131,  // Y 64-79
+    129, 128, 127, 126, 124, 123, 122, 120, 119, 118, 117, 115, 114, 113, 112, 110,  // Y 80-95
+    109, 108, 107, 105, 104, 103, 102, 100, 99, 98, 97, 95, 94, 93, 92, 90,  // Y 96-111
+    89, 88, 87, 85, 84, 83, 82, 80, 79, 78, 77, 75, 74, 73, 72, 70,  // Y 112-127
+    69, 68, 67, 65, 64, 63, 62, 60, 59, 58, 56, 55, 54, 53, 51, 50,  // Y 128-143
+    49, 48, 46, 45, 44, 42, 41, 39, 38, 36, 35, 33, 31, 29, 27, 25,  // Y 144-159
+    23, 20, 17, 13, 9,  // Y 160-164
+};
@@ -2,64 +2,23 @@
 #include "enemies.h"
 #include "scoring.h"
 #include "explosions.h"
+#include "ground.h"
+#include "bcd.h"
+#include "profile.h"
+#include "jobs.h"
+#include "layers.h"
+#include "motion.h"
 
 void checkCollisions()
 {
-    // Check snowball vs enemy collisions
-    for (u8 i = 0; i < MAX_MISSILES; i++)
-    {
-        if (missiles[i].active)
-        {
-            s16 mx = (s16)(missiles[i].x >> FIX16_FRAC_BITS);
-            s16 my = (s16)(missiles[i].y >> FIX16_FRAC_BITS);
-
-            for (u8 j = 0; j < MAX_ENEMIES; j++)
-            {
-                if (enemies[j].active)
-                {
-                    s16 ex = (s16)(enemies[j].x >> FIX16_FRAC_BITS);
-                    s16 ey = (s16)(enemies[j].y >> FIX16_FRAC_BITS);
-
-                    // Simple AABB collision (8px snowball vs 24x16px enemy)
-                    if (abs(mx - ex) < 16 && abs(my - ey) < 12)
-                    {
-                        // Reduce enemy HP by 2
-                        enemies[j].hp -= 2;
-
-                        // Destroy missile
-                        missiles[i].active = FALSE;
-                        SPR_releaseSprite(missiles[i].sprite);
-                        missiles[i].sprite = NULL;
-
-                        // Check if enemy is defeated
-                        if (enemies[j].hp <= 0)
-                        {
-                            // Award points to the player who fired the missile
-                            if (missiles[i].player == 1)
-                                score_p1 += 100;
-                            else
-                                score_p2 += 100;
-
-                            // Check for bonus igloo earned
-                            checkBonusIgloo();
-
-                            // Spawn explosion at enemy position
-                            spawnExplosion(ex, ey);
-
-                            // Destroy enemy
-                            enemies[j].active = FALSE;
-                            SPR_releaseSprite(enemies[j].sprite);
-                            enemies[j].sprite = NULL;
-                        }
+    PROF_BEGIN(PROF_CHECK_COLLISIONS);
 
-                        break;
-                    }
-                }
-            }
-        }
-    }
+    // Plane positions for this tick, worked out once rather than per missile
+    s16 plane_x[MAX_ENEMIES];
+    for (u8 j = 0; j < enemy_count; j++)
+        plane_x[j] = (s16)(getMotionX(&enemies[j].motion) >> FIX16_FRAC_BITS);
 
-    // Check snowball vs large enemy collisions
+    // Check snowball vs plane collisions (every plane type in one pass)
     for (u8 i = 0; i < MAX_MISSILES; i++)
     {
         if (missiles[i].active)
@@ -67,50 +26,42 @@ void checkCollisions()
             s16 mx = (s16)(missiles[i].x >> FIX16_FRAC_BITS);
             s16 my = (s16)(missiles[i].y >> FIX16_FRAC_BITS);
 
-            for (u8 j = 0; j < MAX_LARGE_ENEMIES; j++)
+            for (u8 j = 0; j < enemy_count; j++)
             {
-                if (large_enemies[j].active)
+                const EnemyType* type = enemies[j].type;
+                s16 ex = plane_x[j];
+                s16 ey = (s16)(enemies[j].y >> FIX16_FRAC_BITS);
+
+                // Simple AABB collision (8px snowball vs the plane's sprite box)
+                if (abs(mx - ex) < type->half_width + MISSILE_HIT_MARGIN &&
+                    abs(my - ey) < type->half_height + MISSILE_HIT_MARGIN)
                 {
-                    s16 ex = (s16)(large_enemies[j].x >> FIX16_FRAC_BITS);
-                    s16 ey = (s16)(large_enemies[j].y >> FIX16_FRAC_BITS);
+                    // Reduce enemy HP by 2 and show the hurt sprite (if the type has one)
+                    enemies[j].hp -= 2;
+                    enemies[j].hurt_timer = ENEMY_HURT_DURATION;
 
-                    // Simple AABB collision (8px snowball vs 40x24px large enemy)
-                    if (abs(mx - ex) < 24 && abs(my - ey) < 16)
+                    // Destroy missile
+                    missiles[i].active = FALSE;
+
+                    // Check if enemy is defeated
+                    if (enemies[j].hp <= 0)
                     {
-                        // Reduce large enemy HP by 2
-                        large_enemies[j].hp -= 2;
+                        // Award points to the player who fired the missile
+                        addScore(missiles[i].player, type->score);
 
-                        // Show hurt sprite
-                        large_enemies[j].hurt_timer = LARGE_ENEMY_HURT_DURATION;
+                        // Check for bonus igloo earned (deferred to a quiet frame)
+                        postJob(checkBonusIgloo, JOB_PRIORITY_NORMAL, JOB_DELAY_GAME);
 
-                        // Destroy missile
-                        missiles[i].active = FALSE;
-                        SPR_releaseSprite(missiles[i].sprite);
-                        missiles[i].sprite = NULL;
-
-                        // Check if large enemy is defeated
-                        if (large_enemies[j].hp <= 0)
-                        {
-                            // Award points to the player who fired the missile (200 points for large enemy)
-                            if (missiles[i].player == 1)
-                                score_p1 += 200;
-                            else
-                                score_p2 += 200;
-
-                            // Check for bonus igloo earned
-                            checkBonusIgloo();
-
-                            // Spawn explosion at large enemy position
-                            spawnExplosion(ex, ey);
-
-                            // Destroy large enemy
-                            large_enemies[j].active = FALSE;
-                            SPR_releaseSprite(large_enemies[j].sprite);
-                            large_enemies[j].sprite = NULL;
-                        }
+                        // Spawn explosion at enemy position
+                        spawnExplosion(ex, ey);
 
-                        break;
+                        // Destroy enemy (the last plane moves into slot j, so its
+                        // cached X moves with it)
+                        destroyEnemy(j);
+                        plane_x[j] = plane_x[enemy_count];
                     }
+
+                    break;
                 }
             }
         }
@@ -135,26 +86,19 @@ void checkCollisions()
                     if (abs(mx - bx) < 8 && abs(my - by) < 8)
                     {
                         // Award points to the player who fired the missile
-                        if (missiles[i].player == 1)
-                            score_p1 += 10;
-                        else
-                            score_p2 += 10;
+                        addScore(missiles[i].player, SCORE_BOMB);
 
-                        // Check for bonus igloo earned
-                        checkBonusIgloo();
+                        // Check for bonus igloo earned (deferred to a quiet frame)
+                        postJob(checkBonusIgloo, JOB_PRIORITY_NORMAL, JOB_DELAY_GAME);
 
                         // Spawn explosion at bomb position
                         spawnExplosion(bx, by);
 
                         // Destroy missile
                         missiles[i].active = FALSE;
-                        SPR_releaseSprite(missiles[i].sprite);
-                        missiles[i].sprite = NULL;
 
                         // Destroy bomb
                         bombs[j].active = FALSE;
-                        SPR_releaseSprite(bombs[j].sprite);
-                        bombs[j].sprite = NULL;
 
                         // Apply blast wave (can trigger chain reactions)
                         applyBlastWave(bx, by, missiles[i].player);
@@ -186,25 +130,24 @@ void checkCollisions()
 
                         // Hit! Destroy both
                         bombs[i].active = FALSE;
-                        SPR_releaseSprite(bombs[i].sprite);
-                        bombs[i].sprite = NULL;
 
                         igloos[j].alive = FALSE;
-                        SPR_releaseSprite(igloos[j].sprite);
-                        igloos[j].sprite = NULL;
+                        clearIgloo(j);
                         break;
                     }
                 }
             }
         }
     }
+
+    PROF_END(PROF_CHECK_COLLISIONS);
 }
 
 void checkPolarBearClick(s16 crosshair_x, s16 crosshair_y, u8 player)
 {
     if (!polar_bear.active) return;
 
-    s16 px = (s16)(polar_bear.x >> FIX16_FRAC_BITS);
+    s16 px = (s16)(getMotionX(&polar_bear.motion) >> FIX16_FRAC_BITS);
     s16 py = (s16)(polar_bear.y >> FIX16_FRAC_BITS);
 
     // Check if crosshair is over polar bear (24x16 sprite)
@@ -214,14 +157,11 @@ void checkPolarBearClick(s16 crosshair_x, s16 crosshair_y, u8 player)
         polar_bear.click_count++;
 
         // Calculate score based on click count
-        // 200, 300, 400, 500, etc.
-        u16 score_award = POLAR_BEAR_BASE_SCORE + (polar_bear.click_count - 1) * 100;
+        // 200, 300, 400, 500, etc. (BCD: add 100 per extra click in the hundreds digits)
+        u32 score_award = bcdAdd(POLAR_BEAR_BASE_SCORE, (u32)bcdFromByte(polar_bear.click_count - 1) << 8);
 
         // Award points to the player who clicked
-        if (player == 1)
-            score_p1 += score_award;
-        else
-            score_p2 += score_award;
+        addScore(player, score_award);
 
         // Boost speed on each of the first 3 clicks
         // Click 1: 0.6 -> 1.2 (base + boost)
@@ -230,13 +170,14 @@ void checkPolarBearClick(s16 crosshair_x, s16 crosshair_y, u8 player)
         // Click 4+: stays at 2.4 (no more boosts)
         if (polar_bear.click_count <= POLAR_BEAR_MAX_CLICKS)
         {
+            // Changing speed re-anchors the bear's motion and reschedules its exit
             if (polar_bear.from_left)
             {
-                polar_bear.vx = polar_bear.vx + POLAR_BEAR_SPEED_BOOST;
+                setMotionVelocity(&polar_bear.motion, polar_bear.motion.vx + POLAR_BEAR_SPEED_BOOST);
             }
             else
             {
-                polar_bear.vx = polar_bear.vx - POLAR_BEAR_SPEED_BOOST;
+                setMotionVelocity(&polar_bear.motion, polar_bear.motion.vx - POLAR_BEAR_SPEED_BOOST);
             }
         }
     }
@@ -247,7 +188,8 @@ void checkPowerupTruckClick(s16 crosshair_x, s16 crosshair_y, u8 player)
     if (!powerup_truck.active) return;
     if (powerup_truck.arrow_collected) return;  // Already collected
 
-    s16 tx = (s16)(powerup_truck.x >> FIX16_FRAC_BITS);
+    fix16 truck_x = getMotionX(&powerup_truck.motion);
+    s16 tx = (s16)(truck_x >> FIX16_FRAC_BITS);
     s16 ty = TRUCK_Y;
 
     // Check if crosshair is over truck (24x24 sprite)
@@ -255,7 +197,7 @@ void checkPowerupTruckClick(s16 crosshair_x, s16 crosshair_y, u8 player)
     {
         // Clicked on truck! Collect powerup
         powerup_truck.arrow_collected = TRUE;
-        powerup_truck.arrow_x = powerup_truck.x;  // Fix arrow X position
+        powerup_truck.arrow_x = truck_x;  // Fix arrow X position
         powerup_truck.arrow_start_y = powerup_truck.arrow_y;  // Record starting Y
         powerup_truck.arrow_vy = TRUCK_ARROW_VY;  // Start moving upward
         powerup_truck.arrow_hold_timer = 0;  // Reset hold timer
@@ -268,9 +210,9 @@ void checkPowerupTruckClick(s16 crosshair_x, s16 crosshair_y, u8 player)
             case 0:
                 // Powerup 1: Award 25 snowballs
                 if (player == 1)
-                    ammo_p1 += 25;
+                    ammo_p1 = bcdAdd(ammo_p1, 0x25);
                 else
-                    ammo_p2 += 25;
+                    ammo_p2 = bcdAdd(ammo_p2, 0x25);
                 break;
 
             case 1:
@@ -1,28 +1,80 @@
 #include "enemies.h"
 #include "explosions.h"
 #include "resources.h"
+#include "layers.h"
+#include "scoring.h"
+#include "bcd.h"
+#include "telemetry.h"
+#include "profile.h"
+#include "timestep.h"
+#include "motion.h"
+#include "bomb_table.h"
+#include "throttle.h"
+#include "governor.h"
+
+// Plane types. Every plane in enemies[] points at one of these, so adding a
+// type is a new entry here rather than another pool and set of loops.
+const EnemyType enemy_types[ENEMY_TYPE_COUNT] =
+{
+    // ENEMY_TYPE_SMALL: 24x16, two snowballs
+    { &sprite_plane, NULL, 12, 8, 2, SCORE_PLANE, SCORE_PLANE_BLAST },
+    // ENEMY_TYPE_LARGE: 40x24, four snowballs, flashes when hit
+    { &sprite_plane_large, &sprite_plane_large_hurt, 20, 12, 4, SCORE_LARGE_PLANE, SCORE_LARGE_PLANE_BLAST },
+};
 
-void initEnemies()
+// Spawn positions (see SPAWN_* in common.h), built once by initSpawnSlots()
+typedef struct {
+    s16 x, y;
+} SpawnSlot;
+
+static SpawnSlot spawn_slots[SPAWN_SLOTS];
+static u8 slot_order[SPAWN_SLOTS];  // Shuffled at the start of every wave
+
+static void initSpawnSlots()
 {
-    // Initialize enemy pool
-    for (u8 i = 0; i < MAX_ENEMIES; i++)
+    u8 count = 0;
+    for (u8 side = 0; side < 2; side++)
     {
-        enemies[i].active = FALSE;
-        enemies[i].sprite = NULL;
+        for (u8 lane = 0; lane < SPAWN_LANES; lane++)
+        {
+            for (u8 column = 0; column < SPAWN_COLUMNS; column++)
+            {
+                // Checkerboard: skip every other cell
+                if ((lane + column) & 1)
+                    continue;
+
+                s16 offset = SPAWN_OFFSET_FIRST + column * SPAWN_GRID_STEP;
+                spawn_slots[count].x = side ? SCREEN_WIDTH + offset : -offset;
+                spawn_slots[count].y = SPAWN_LANE_TOP + lane * SPAWN_GRID_STEP;
+                slot_order[count] = count;
+                count++;
+            }
+        }
     }
+}
 
-    // Initialize large enemy pool
-    for (u8 i = 0; i < MAX_LARGE_ENEMIES; i++)
+// Partial Fisher-Yates shuffle: put a random choice of slots in the first
+// `count` places. Scaling a 16-bit random() by the range avoids a division.
+static void shuffleSpawnSlots(u8 count)
+{
+    for (u8 i = 0; i < count; i++)
     {
-        large_enemies[i].active = FALSE;
-        large_enemies[i].sprite = NULL;
+        u8 j = i + (((u32)random() * (SPAWN_SLOTS - i)) >> 16);
+        u8 tmp = slot_order[i];
+        slot_order[i] = slot_order[j];
+        slot_order[j] = tmp;
     }
+}
+
+void initEnemies()
+{
+    // Initialize enemy pool (empty; entries are filled in as planes enter)
+    enemy_count = 0;
 
     // Initialize bomb pool
     for (u8 i = 0; i < MAX_BOMBS; i++)
     {
         bombs[i].active = FALSE;
-        bombs[i].sprite = NULL;
     }
 
     // Initialize powerup truck
@@ -30,6 +82,8 @@ void initEnemies()
     powerup_truck.spawn_pending = FALSE;
     powerup_truck.spawn_timer = 0;
     powerup_truck.sprite = NULL;
+    powerup_truck.arrow_sprite = NULL;
+    powerup_truck.arrow_active = FALSE;
 
     // Initialize polar bear
     polar_bear.active = FALSE;
@@ -37,283 +91,308 @@ void initEnemies()
     polar_bear.spawn_timer = 0;
     polar_bear.click_count = 0;
     polar_bear.sprite = NULL;
+
+    initSpawnSlots();
 }
 
-// Determine how many enemies to spawn based on wave number
-u8 getEnemyCountForWave(u16 wave)
+// Parameters of the wave in play, loaded from the generated table at wave start
+WaveParams wave_params;
+
+static void loadWaveParams(u16 wave)
 {
-    if (wave <= 3) return 3;
-    if (wave <= 7) return 4;
-    if (wave <= 15) return 5;
-    if (wave <= 25) return 6;
-    return 7;
+    u16 index = wave ? wave : 1;
+
+    // Past the end of the table, waves repeat its final loop region
+    if (index > WAVE_TABLE_LENGTH)
+        index = WAVE_TABLE_LOOP_START + (index - WAVE_TABLE_LOOP_START) % WAVE_TABLE_LOOP_LENGTH;
+
+    wave_params = wave_table[index - 1];
 }
 
-// Determine how many large enemies to spawn based on wave number
-u8 getLargeEnemyCountForWave(u16 wave)
+// Planned entries for the current wave, in entry order. spawnWave() only works
+// out where and when each plane appears; the planes are activated (and get
+// their sprites) a few per tick by updateWaveEntries().
+typedef struct {
+    s16 x, y;
+    fix16 vx;
+    u8 type;         // ENEMY_TYPE_*
+    u8 path;         // FLIGHT_PATH_*
+    u8 from_left;
+    u32 entry_tick;  // game_ticks value at which the plane enters
+} WaveEntry;
+
+static WaveEntry wave_entries[MAX_ENEMIES];
+static u8 wave_entry_count = 0;
+static u8 wave_entry_next = 0;     // Next entry to activate
+static u8 pending_enemies = 0;     // Planned planes not yet activated
+
+// Pick one of the wave's flight paths at random
+static u8 pickFlightPath(u8 paths)
 {
-    if (wave < 5) return 0;          // No large enemies before wave 5
-    if (wave < 15) return 1;         // 1 large enemy waves 5-14
-    if (wave < 25) return 2;         // 2 large enemies waves 15-24
-    if (wave < 45) return 3;         // 3 large enemies waves 25-44
-    if (wave < 65) return 4;         // 4 large enemies waves 45-64
-    return 5;                         // 5 large enemies wave 65+
+    u8 choices[FLIGHT_PATH_COUNT];
+    u8 count = 0;
+    for (u8 i = 0; i < FLIGHT_PATH_COUNT; i++)
+    {
+        if (paths & (1 << i))
+            choices[count++] = i;
+    }
+
+    if (count == 0)
+        return FLIGHT_PATH_LEVEL;
+    return choices[((u32)random() * count) >> 16];
 }
 
-// Determine base enemy speed based on wave number
-fix16 getEnemySpeedForWave(u16 wave)
+// Plan one plane: a spawn slot (which sets its side and position) and a speed
+static void planWaveEntry(u8 type)
 {
-    if (wave < 10) return ENEMY_SPEED;        // Waves 1-9: 0.3
-    if (wave < 20) return FIX16(0.35);        // Waves 10-19: 0.35
-    if (wave < 30) return FIX16(0.37);        // Waves 20-29: 0.37
-    if (wave < 40) return FIX16(0.40);        // Waves 30-39: 0.40
-    if (wave < 50) return FIX16(0.45);        // Waves 40-49: 0.45
-    return FIX16(0.50);                       // Wave 50+: 0.50
+    WaveEntry* entry = &wave_entries[wave_entry_count];
+
+    // Take the next slot from this wave's shuffled order; the slots are
+    // spaced apart by construction, so no retries or overlap checks are needed
+    const SpawnSlot* spawn = &spawn_slots[slot_order[wave_entry_count]];
+    s16 spawn_x = spawn->x;
+    s16 spawn_y = spawn->y;
+    u8 from_left = (spawn_x < 0);
+
+    // Get base speed for this wave and add random velocity offset: +/- 33% variation
+    fix16 base_speed = wave_params.speed;
+    s16 velocity_percent = (random() % 67) - 33;  // Range: -33 to +33 percent
+    fix16 speed_variation = (base_speed * velocity_percent) / 100;
+
+    entry->x = spawn_x;
+    entry->y = spawn_y;
+    entry->vx = from_left ? base_speed + speed_variation : -base_speed - speed_variation;
+    entry->type = type;
+    entry->path = pickFlightPath(wave_params.paths);
+    entry->from_left = from_left;
+    entry->entry_tick = game_ticks + (u32)wave_entry_count * WAVE_ENTRY_INTERVAL;
+    wave_entry_count++;
 }
 
 void spawnWave()
 {
-    // Determine enemy count for this wave
-    u8 enemy_count = getEnemyCountForWave(current_wave);
-
-    // Track spawn positions to enforce spacing
-    typedef struct {
-        s16 x, y;
-    } SpawnPos;
-    SpawnPos spawn_positions[MAX_ENEMIES + MAX_LARGE_ENEMIES];
-    u8 spawn_count = 0;
-
-    // Spawn enemies at random positions
-    for (u8 i = 0; i < enemy_count; i++)
-    {
-        // Random side (0 = left, 1 = right)
-        u8 from_left = random() % 2;
+    PROF_BEGIN(PROF_SPAWN_WAVE);
 
-        // Try to find a valid spawn position (max 10 attempts)
-        s16 spawn_y = 0;
-        s16 spawn_x = 0;
-        u8 valid_position = FALSE;
+    // Load this wave's parameters once
+    loadWaveParams(current_wave);
+    u8 small_count = wave_params.planes;
+    u8 large_count = wave_params.large_planes;
 
-        for (u8 attempt = 0; attempt < 10; attempt++)
-        {
-            // Random Y position between 16 and 132-16
-            spawn_y = 16 + (random() % 101);
+    // Plan every plane up front, regular planes first
+    wave_entry_count = 0;
+    wave_entry_next = 0;
+    shuffleSpawnSlots(small_count + large_count);
 
-            // Set position based on spawn side
-            s16 spawn_offset = 20 + (random() % 40);  // Range: 20 to 59 pixels off-screen
+    for (u8 i = 0; i < small_count; i++)
+        planWaveEntry(ENEMY_TYPE_SMALL);
 
-            if (from_left)
-                spawn_x = -spawn_offset;
-            else
-                spawn_x = SCREEN_WIDTH + spawn_offset;
+    for (u8 i = 0; i < large_count; i++)
+        planWaveEntry(ENEMY_TYPE_LARGE);
 
-            // Check distance to all previously spawned enemies
-            valid_position = TRUE;
-            for (u8 j = 0; j < spawn_count; j++)
-            {
-                s16 dx = abs(spawn_x - spawn_positions[j].x);
-                s16 dy = abs(spawn_y - spawn_positions[j].y);
-                s16 dist = dx + dy;  // Manhattan distance
-
-                if (dist < ENEMY_MIN_SPACING)
-                {
-                    valid_position = FALSE;
-                    break;
-                }
-            }
-
-            if (valid_position)
-                break;
-        }
-
-        // Record this spawn position
-        spawn_positions[spawn_count].x = spawn_x;
-        spawn_positions[spawn_count].y = spawn_y;
-        spawn_count++;
-
-        // Get base speed for this wave and add random velocity offset: +/- 33% variation
-        fix16 base_speed = getEnemySpeedForWave(current_wave);
-        s16 velocity_percent = (random() % 67) - 33;  // Range: -33 to +33 percent
-        fix16 speed_variation = (base_speed * velocity_percent) / 100;
-
-        if (from_left)
-        {
-            enemies[i].x = FIX16(spawn_x);  // Start off left edge
-            enemies[i].vx = base_speed + speed_variation;  // Move right with variation
-        }
-        else
-        {
-            enemies[i].x = FIX16(spawn_x);  // Start off right edge
-            enemies[i].vx = -base_speed - speed_variation;  // Move left with variation
-        }
-
-        enemies[i].y = FIX16(spawn_y);
-        enemies[i].from_left = from_left;
-        enemies[i].hp = 2;
-        enemies[i].active = TRUE;
+    pending_enemies = small_count + large_count;
+    enemies_spawned = pending_enemies;
+    wave_complete = FALSE;
 
-        // Create sprite (24x16, so offset by 12 horizontally and 8 vertically)
-        s16 sprite_x = (s16)(enemies[i].x >> FIX16_FRAC_BITS) - 12;
-        s16 sprite_y = spawn_y - 8;
+    PROF_END(PROF_SPAWN_WAVE);
+}
 
-        enemies[i].sprite = SPR_addSprite(&sprite_plane,
-                                           sprite_x,
-                                           sprite_y,
-                                           TILE_ATTR(PAL2, 0, FALSE, from_left ? FALSE : TRUE));
+// Bring a planned plane into play
+static void activateWaveEntry(const WaveEntry* entry)
+{
+    pending_enemies--;
+    if (enemy_count == MAX_ENEMIES)
+    {
+        telemetryAllocFailed();
+        return;
     }
 
-    enemies_spawned = enemy_count;
-
-    // Spawn large enemies
-    u8 large_enemy_count = getLargeEnemyCountForWave(current_wave);
+    Enemy* enemy = &enemies[enemy_count++];
+    enemy->type = &enemy_types[entry->type];
+    enemy->y = FIX16(entry->y);
+    enemy->from_left = entry->from_left;
+
+    // Flies straight across; the tick it leaves the far edge is known now
+    startMotion(&enemy->motion, FIX16(entry->x), entry->vx, entry->from_left ? SCREEN_WIDTH : 0);
+    enemy->hp = enemy->type->hp;
+    enemy->hurt_timer = 0;
+    enemy->path = &flight_paths[entry->path];
+    enemy->path_step = 0;
+    enemy->aim_igloo = NO_AIM_TARGET;
+    enemy->next_drop = DROP_UNSCHEDULED;  // Drop clock starts once the plane is on screen
+
+    // Planes start off-screen; updateEnemies() gives them a sprite once in view
+    enemy->sprite = NULL;
+}
 
-    for (u8 i = 0; i < large_enemy_count; i++)
-    {
-        // Random side (0 = left, 1 = right)
-        u8 from_left = random() % 2;
+void destroyEnemy(u8 i)
+{
+    releaseLayerSprite(&enemies[i].sprite);
 
-        // Try to find a valid spawn position (max 10 attempts)
-        s16 spawn_y = 0;
-        s16 spawn_x = 0;
-        u8 valid_position = FALSE;
+    // Keep the pool dense: the last plane takes this slot
+    enemy_count--;
+    if (i != enemy_count)
+        enemies[i] = enemies[enemy_count];
+}
 
-        for (u8 attempt = 0; attempt < 10; attempt++)
-        {
-            // Random Y position between 16 and 132-16
-            spawn_y = 16 + (random() % 101);
+void updateWaveEntries()
+{
+    // Activate planes whose entry time has come, a few per tick at most
+    u8 activated = 0;
+    while (wave_entry_next < wave_entry_count && activated < WAVE_ACTIVATIONS_PER_TICK &&
+           wave_entries[wave_entry_next].entry_tick <= game_ticks)
+    {
+        activateWaveEntry(&wave_entries[wave_entry_next]);
+        wave_entry_next++;
+        activated++;
+    }
+}
 
-            // Set position based on spawn side
-            s16 spawn_offset = 20 + (random() % 40);  // Range: 20 to 59 pixels off-screen
+// Ticks until a plane's next bomb drop: geometric with the wave's per-tick
+// drop chance, from the generated -ln(u) table (see create_wave_table.py)
+static u16 sampleDropGap()
+{
+    u32 neglog = drop_gap_neglog[random() & (DROP_GAP_TABLE_SIZE - 1)];
+    return (u16)((neglog * wave_params.drop_scale) >> 12) + 1;
+}
 
-            if (from_left)
-                spawn_x = -spawn_offset;
-            else
-                spawn_x = SCREEN_WIDTH + spawn_offset;
+// Random bombing: TRUE on the ticks a plane's scheduled drops fall due.
+// Only called while the plane is on screen, which is what the drop chance
+// applies to, so the first gap is counted from the first tick on screen.
+static u8 isDropDue(Enemy* enemy)
+{
+    if (wave_params.drop_scale == 0)
+        return FALSE;
 
-            // Check distance to all previously spawned enemies (regular + large)
-            valid_position = TRUE;
-            for (u8 j = 0; j < spawn_count; j++)
-            {
-                s16 dx = abs(spawn_x - spawn_positions[j].x);
-                s16 dy = abs(spawn_y - spawn_positions[j].y);
-                s16 dist = dx + dy;  // Manhattan distance
+    if (enemy->next_drop == DROP_UNSCHEDULED)
+        enemy->next_drop = game_ticks + sampleDropGap() - 1;
 
-                if (dist < ENEMY_MIN_SPACING)
-                {
-                    valid_position = FALSE;
-                    break;
-                }
-            }
+    if (game_ticks < enemy->next_drop)
+        return FALSE;
 
-            if (valid_position)
-                break;
-        }
+    enemy->next_drop += sampleDropGap();
+    return TRUE;
+}
 
-        // Record this spawn position
-        spawn_positions[spawn_count].x = spawn_x;
-        spawn_positions[spawn_count].y = spawn_y;
-        spawn_count++;
+// Aimed bombing: TRUE when a bomb released now, carrying the plane's speed,
+// would land on a living igloo the plane hasn't already bombed. The fall time
+// comes from the generated table, so this is a lookup and a few compares.
+static u8 isOverAimPoint(Enemy* enemy, s16 ex, s16 ey)
+{
+    if (ey >= BOMB_FALL_TABLE_SIZE)
+        return FALSE;  // Already down at the igloos
+    if (ey < 0)
+        ey = 0;
 
-        // Get base speed for this wave and add random velocity offset: +/- 33% variation
-        fix16 base_speed = getEnemySpeedForWave(current_wave);
-        s16 velocity_percent = (random() % 67) - 33;  // Range: -33 to +33 percent
-        fix16 speed_variation = (base_speed * velocity_percent) / 100;
+    s16 landing_x = ex + (s16)(((s32)enemy->motion.vx * bomb_fall_ticks[ey]) >> FIX16_FRAC_BITS);
 
-        if (from_left)
-        {
-            large_enemies[i].x = FIX16(spawn_x);  // Start off left edge
-            large_enemies[i].vx = base_speed + speed_variation;  // Move right with variation
-        }
-        else
+    for (u8 i = 0; i < NUM_IGLOOS; i++)
+    {
+        if (igloos[i].alive && i != enemy->aim_igloo &&
+            abs(landing_x - igloos[i].x) <= BOMB_AIM_TOLERANCE)
         {
-            large_enemies[i].x = FIX16(spawn_x);  // Start off right edge
-            large_enemies[i].vx = -base_speed - speed_variation;  // Move left with variation
+            enemy->aim_igloo = i;
+            return TRUE;
         }
-
-        large_enemies[i].y = FIX16(spawn_y);
-        large_enemies[i].from_left = from_left;
-        large_enemies[i].hp = 4;  // Large enemies have 4 HP
-        large_enemies[i].hurt_timer = 0;  // Not hurt initially
-        large_enemies[i].active = TRUE;
-
-        // Create sprite (40x24, so offset by 20 horizontally and 12 vertically)
-        s16 sprite_x = (s16)(large_enemies[i].x >> FIX16_FRAC_BITS) - 20;
-        s16 sprite_y = spawn_y - 12;
-
-        large_enemies[i].sprite = SPR_addSprite(&sprite_plane_large,
-                                                 sprite_x,
-                                                 sprite_y,
-                                                 TILE_ATTR(PAL2, 0, FALSE, from_left ? FALSE : TRUE));
     }
-
-    large_enemies_spawned = large_enemy_count;
-    wave_complete = FALSE;
+    return FALSE;
 }
 
 void updateEnemies()
 {
-    u8 active_count = 0;
+    u8 aimed = (wave_params.flags & WAVE_FLAG_AIMED) != 0;
 
-    for (u8 i = 0; i < MAX_ENEMIES; i++)
+    u8 i = 0;
+    while (i < enemy_count)
     {
-        if (enemies[i].active)
+        Enemy* enemy = &enemies[i];
+        const EnemyType* type = enemy->type;
+
+        // Exit tick was scheduled at spawn
+        if (hasMotionExited(&enemy->motion))
         {
-            active_count++;
+            // Enemy escaped; the last plane moves into this slot, so don't advance
+            destroyEnemy(i);
+            continue;
+        }
 
-            // Move enemy horizontally
-            enemies[i].x = enemies[i].x + enemies[i].vx;
+        // Follow the flight path: one baked step per tick
+        const FlightPath* path = enemy->path;
+        enemy->y = enemy->y + path->deltas[enemy->path_step];
+        if (++enemy->path_step == path->length)
+            enemy->path_step = path->loop;
 
-            s16 ex = (s16)(enemies[i].x >> FIX16_FRAC_BITS);
-            s16 ey = (s16)(enemies[i].y >> FIX16_FRAC_BITS);
+        fix16 x = getMotionX(&enemy->motion);
+        s16 ex = (s16)(x >> FIX16_FRAC_BITS);
+        s16 ey = (s16)(enemy->y >> FIX16_FRAC_BITS);
 
-            // Check if enemy went off screen
-            if ((enemies[i].from_left && ex > SCREEN_WIDTH) ||
-                (!enemies[i].from_left && ex < 0))
-            {
-                // Enemy escaped
-                enemies[i].active = FALSE;
-                SPR_releaseSprite(enemies[i].sprite);
-                enemies[i].sprite = NULL;
-            }
-            else
-            {
-                // Update sprite position (24x16 sprite)
-                SPR_setPosition(enemies[i].sprite, ex - 12, ey - 8);
+        // Handle hurt timer; types with hurt art swap sprites when it starts and ends
+        u8 swap_sprite = FALSE;
+        if (enemy->hurt_timer > 0)
+        {
+            enemy->hurt_timer--;
+            swap_sprite = (type->hurt_def != NULL &&
+                           (enemy->hurt_timer == ENEMY_HURT_DURATION - 1 || enemy->hurt_timer == 0));
+        }
 
-                // Only drop bombs when fully on screen (at least 12 pixels from edge)
-                u8 on_screen = (ex >= 12 && ex <= SCREEN_WIDTH - 12);
+        // Only hold a sprite while the plane is in view
+        s16 sprite_x = ex - type->half_width;
+        s16 sprite_y = ey - type->half_height;
+        if (!isBoxOnScreen(sprite_x, sprite_y, type->half_width * 2, type->half_height * 2))
+        {
+            releaseLayerSprite(&enemy->sprite);
+        }
+        else if (enemy->sprite == NULL || swap_sprite)
+        {
+            // Hurt sprite while the hurt timer runs, normal sprite otherwise
+            releaseLayerSprite(&enemy->sprite);
+            enemy->sprite = addLayerSprite((enemy->hurt_timer && type->hurt_def) ? type->hurt_def : type->sprite_def,
+                                           sprite_x,
+                                           sprite_y,
+                                           TILE_ATTR(PAL2, 0, FALSE, enemy->from_left ? FALSE : TRUE),
+                                           LAYER_PLANES);
+            enemy->draw_x = sprite_x;
+            enemy->draw_y = sprite_y;
+        }
+        // Update sprite position only when the pixel changed,
+        // slow planes keep the same pixel for several frames
+        else if (sprite_x != enemy->draw_x || sprite_y != enemy->draw_y)
+        {
+            SPR_setPosition(enemy->sprite, sprite_x, sprite_y);
+            enemy->draw_x = sprite_x;
+            enemy->draw_y = sprite_y;
+        }
 
-                // Randomly drop bombs (0.2% base chance, scales with wave)
-                u16 drop_chance = BOMB_DROP_CHANCE * current_wave;
-                if (drop_chance > 300) drop_chance = 300;  // Cap at 30%
+        // Only drop bombs when fully on screen (at least half the sprite width from the edge)
+        u8 on_screen = (ex >= type->half_width && ex <= SCREEN_WIDTH - type->half_width);
 
-                if (on_screen && (random() % 1000) < drop_chance)
+        // Drop bombs at the times scheduled from this wave's drop chance,
+        // or in aimed waves release them over the igloos
+        if (on_screen && (aimed ? isOverAimPoint(enemy, ex, ey) : isDropDue(enemy)))
+        {
+            // Find an inactive bomb slot
+            u8 j;
+            for (j = 0; j < MAX_BOMBS; j++)
+            {
+                if (!bombs[j].active)
                 {
-                    // Find an inactive bomb slot
-                    for (u8 j = 0; j < MAX_BOMBS; j++)
-                    {
-                        if (!bombs[j].active)
-                        {
-                            bombs[j].x = enemies[i].x;
-                            bombs[j].y = enemies[i].y;
-                            bombs[j].vx = FIX16(0);  // No horizontal velocity initially
-                            bombs[j].vy = BOMB_INITIAL_VY;
-                            bombs[j].active = TRUE;
-
-                            bombs[j].sprite = SPR_addSprite(&sprite_bomb,
-                                                             ex - 4,
-                                                             ey - 4,
-                                                             TILE_ATTR(PAL2, 0, FALSE, FALSE));
-                            break;  // Only drop one bomb
-                        }
-                    }
+                    bombs[j].x = x;
+                    bombs[j].y = enemy->y;
+                    bombs[j].vx = aimed ? enemy->motion.vx : FIX16(0);  // Aimed bombs keep the plane's speed
+                    bombs[j].vy = BOMB_INITIAL_VY;
+                    bombs[j].active = TRUE;
+                    bombs[j].half_rate = FALSE;
+                    break;  // Only drop one bomb
                 }
             }
+            if (j == MAX_BOMBS)
+                telemetryAllocFailed();
         }
+
+        i++;
     }
 
-    // Check if wave is complete (no active enemies)
-    if (active_count == 0 && enemies_spawned > 0 && !wave_complete)
+    // Check if wave is complete (no active enemies and none still waiting to enter)
+    if (enemy_count == 0 && pending_enemies == 0 && enemies_spawned > 0 && !wave_complete)
     {
         wave_complete = TRUE;
         current_wave++;
@@ -326,128 +405,57 @@ void updateEnemies()
 
         if (two_player_mode)
         {
-            u16 ammo_reward = 7 + (wave_bonus_multiplier * 1);
-            ammo_p1 += ammo_reward;
-            ammo_p2 += ammo_reward;
+            u8 ammo_reward = bcdFromByte(7 + (wave_bonus_multiplier * 1));
+            ammo_p1 = bcdAdd(ammo_p1, ammo_reward);
+            ammo_p2 = bcdAdd(ammo_p2, ammo_reward);
         }
         else
         {
-            u16 ammo_reward = 15 + (wave_bonus_multiplier * 2);
-            ammo_p1 += ammo_reward;
+            u8 ammo_reward = bcdFromByte(15 + (wave_bonus_multiplier * 2));
+            ammo_p1 = bcdAdd(ammo_p1, ammo_reward);
         }
     }
 }
 
-void updateLargeEnemies()
+void updateBombs()
 {
-    u8 active_count = 0;
-
-    for (u8 i = 0; i < MAX_LARGE_ENEMIES; i++)
+    for (u8 i = 0; i < MAX_BOMBS; i++)
     {
-        if (large_enemies[i].active)
+        if (bombs[i].active)
         {
-            active_count++;
-
-            // Move large enemy horizontally
-            large_enemies[i].x = large_enemies[i].x + large_enemies[i].vx;
-
-            s16 ex = (s16)(large_enemies[i].x >> FIX16_FRAC_BITS);
-            s16 ey = (s16)(large_enemies[i].y >> FIX16_FRAC_BITS);
-
-            // Check if large enemy went off screen
-            if ((large_enemies[i].from_left && ex > SCREEN_WIDTH) ||
-                (!large_enemies[i].from_left && ex < 0))
+            // Under load, bombs high above the igloos or off screen run at half
+            // rate; bombs near the igloos always update every tick. Which ones
+            // is decided at the start of each tick pair, so a bomb crossing
+            // THROTTLE_BOMB_Y still finishes the pair it started.
+            u8 step = 1;
+            if (throttle_active)
             {
-                // Large enemy escaped
-                large_enemies[i].active = FALSE;
-                SPR_releaseSprite(large_enemies[i].sprite);
-                large_enemies[i].sprite = NULL;
-            }
-            else
-            {
-                // Handle hurt timer and sprite swapping
-                if (large_enemies[i].hurt_timer > 0)
+                if (!(game_ticks & 1))
                 {
-                    large_enemies[i].hurt_timer--;
-
-                    // If timer just started, swap to hurt sprite
-                    if (large_enemies[i].hurt_timer == LARGE_ENEMY_HURT_DURATION - 1)
-                    {
-                        // Release old sprite and create hurt sprite
-                        SPR_releaseSprite(large_enemies[i].sprite);
-                        large_enemies[i].sprite = SPR_addSprite(&sprite_plane_large_hurt,
-                                                                 ex - 20,
-                                                                 ey - 12,
-                                                                 TILE_ATTR(PAL2, 0, FALSE, large_enemies[i].from_left ? FALSE : TRUE));
-                    }
-                    // If timer expired, swap back to normal sprite
-                    else if (large_enemies[i].hurt_timer == 0)
-                    {
-                        // Release hurt sprite and create normal sprite
-                        SPR_releaseSprite(large_enemies[i].sprite);
-                        large_enemies[i].sprite = SPR_addSprite(&sprite_plane_large,
-                                                                 ex - 20,
-                                                                 ey - 12,
-                                                                 TILE_ATTR(PAL2, 0, FALSE, large_enemies[i].from_left ? FALSE : TRUE));
-                    }
+                    s16 bx = (s16)(bombs[i].x >> FIX16_FRAC_BITS);
+                    s16 by = (s16)(bombs[i].y >> FIX16_FRAC_BITS);
+                    bombs[i].half_rate = (by < THROTTLE_BOMB_Y || bx < 0 || bx >= SCREEN_WIDTH);
                 }
-
-                // Update sprite position (40x24 sprite)
-                SPR_setPosition(large_enemies[i].sprite, ex - 20, ey - 12);
-
-                // Only drop bombs when fully on screen (at least 20 pixels from edge for 40px wide sprite)
-                u8 on_screen = (ex >= 20 && ex <= SCREEN_WIDTH - 20);
-
-                // Randomly drop bombs (same chance as regular enemies)
-                u16 drop_chance = BOMB_DROP_CHANCE * current_wave;
-                if (drop_chance > 300) drop_chance = 300;  // Cap at 30%
-
-                if (on_screen && (random() % 1000) < drop_chance)
+                if (bombs[i].half_rate)
                 {
-                    // Find an inactive bomb slot
-                    for (u8 j = 0; j < MAX_BOMBS; j++)
-                    {
-                        if (!bombs[j].active)
-                        {
-                            bombs[j].x = large_enemies[i].x;
-                            bombs[j].y = large_enemies[i].y;
-                            bombs[j].vx = FIX16(0);  // No horizontal velocity initially
-                            bombs[j].vy = BOMB_INITIAL_VY;
-                            bombs[j].active = TRUE;
-
-                            bombs[j].sprite = SPR_addSprite(&sprite_bomb,
-                                                             ex - 4,
-                                                             ey - 4,
-                                                             TILE_ATTR(PAL2, 0, FALSE, FALSE));
-                            break;  // Only drop one bomb
-                        }
-                    }
+                    step = getThrottleStep(i);
+                    if (step == 0)
+                        continue;
                 }
             }
-        }
-    }
-
-    // Check if all large enemies are gone
-    if (active_count == 0 && large_enemies_spawned > 0)
-    {
-        large_enemies_spawned = 0;
-    }
-}
 
-void updateBombs()
-{
-    for (u8 i = 0; i < MAX_BOMBS; i++)
-    {
-        if (bombs[i].active)
-        {
-            // Apply gravity
-            bombs[i].vy = bombs[i].vy + BOMB_GRAVITY;
-            if (bombs[i].vy > BOMB_MAX_VY)
-                bombs[i].vy = BOMB_MAX_VY;
+            // Apply gravity and move, once per tick owed. A double step follows
+            // the same path and steps always come in complete pairs, so aimed
+            // bombs still land where they were aimed.
+            for (u8 s = 0; s < step; s++)
+            {
+                bombs[i].vy = bombs[i].vy + BOMB_GRAVITY;
+                if (bombs[i].vy > BOMB_MAX_VY)
+                    bombs[i].vy = BOMB_MAX_VY;
 
-            // Move bomb (both horizontal and vertical)
-            bombs[i].x = bombs[i].x + bombs[i].vx;
-            bombs[i].y = bombs[i].y + bombs[i].vy;
+                bombs[i].x = bombs[i].x + bombs[i].vx;
+                bombs[i].y = bombs[i].y + bombs[i].vy;
+            }
 
             s16 bx = (s16)(bombs[i].x >> FIX16_FRAC_BITS);
             s16 by = (s16)(bombs[i].y >> FIX16_FRAC_BITS);
@@ -455,13 +463,11 @@ void updateBombs()
             // Check if bomb reached ground level (CANNON_Y + 5 pixels)
             if (by >= CANNON_Y + 5)
             {
-                // Explode at ground level
-                spawnExplosion(bx, by);
+                // Explode at ground level (cosmetic: skipped under heavy load)
+                spawnCosmeticExplosion(bx, by);
 
                 // Destroy bomb
                 bombs[i].active = FALSE;
-                SPR_releaseSprite(bombs[i].sprite);
-                bombs[i].sprite = NULL;
 
                 // Apply blast wave (no player attribution since it hit ground)
                 applyBlastWave(bx, by, 0);
@@ -470,20 +476,11 @@ void updateBombs()
             else if (bx < -20 || bx > SCREEN_WIDTH + 20)
             {
                 bombs[i].active = FALSE;
-                SPR_releaseSprite(bombs[i].sprite);
-                bombs[i].sprite = NULL;
             }
             // Check if bomb went off screen (bottom)
             else if (by > SCREEN_HEIGHT)
             {
                 bombs[i].active = FALSE;
-                SPR_releaseSprite(bombs[i].sprite);
-                bombs[i].sprite = NULL;
-            }
-            else
-            {
-                // Update sprite position
-                SPR_setPosition(bombs[i].sprite, bx - 4, by - 4);
             }
         }
     }
@@ -494,6 +491,16 @@ void updateBombs()
 // Player parameter indicates who triggered the blast (for scoring)
 void applyBlastWave(s16 bx, s16 by, u8 player)
 {
+    // Depth of the chain reaction this blast belongs to (1 = the first blast)
+    static u8 blast_depth = 0;
+
+    PROF_BEGIN(PROF_BLAST_WAVE);
+    blast_depth++;
+
+    // Under heavy load the governor stops long chains: past the cap, bombs in
+    // the chain radius are only knocked back instead of going off
+    u8 can_chain = (governor_level < GOVERNOR_SHORT_CHAINS || blast_depth <= GOVERNOR_MAX_CHAIN_DEPTH);
+
     // Apply blast effects to bombs
     for (u8 k = 0; k < MAX_BOMBS; k++)
     {
@@ -509,12 +516,10 @@ void applyBlastWave(s16 bx, s16 by, u8 player)
             s16 dist = abs(dx) + abs(dy);  // Manhattan distance (faster than sqrt)
 
             // If within chain radius, destroy and trigger new blast wave
-            if (dist < BOMB_CHAIN_RADIUS && dist > 0)
+            if (dist < BOMB_CHAIN_RADIUS && dist > 0 && can_chain)
             {
                 // Destroy this bomb
                 bombs[k].active = FALSE;
-                SPR_releaseSprite(bombs[k].sprite);
-                bombs[k].sprite = NULL;
 
                 // Recursively trigger blast wave from this bomb's position
                 applyBlastWave(other_bx, other_by, player);
@@ -539,102 +544,43 @@ void applyBlastWave(s16 bx, s16 by, u8 player)
     }
 
     // Apply blast damage to enemies
-    for (u8 k = 0; k < MAX_ENEMIES; k++)
+    u8 k = 0;
+    while (k < enemy_count)
     {
-        if (enemies[k].active)
-        {
-            // Get position of this enemy
-            s16 enemy_x = (s16)(enemies[k].x >> FIX16_FRAC_BITS);
-            s16 enemy_y = (s16)(enemies[k].y >> FIX16_FRAC_BITS);
-
-            // Calculate distance from impact point
-            s16 dx = enemy_x - bx;
-            s16 dy = enemy_y - by;
-            s16 dist = abs(dx) + abs(dy);  // Manhattan distance (faster than sqrt)
+        // Get position of this enemy
+        s16 enemy_x = (s16)(getMotionX(&enemies[k].motion) >> FIX16_FRAC_BITS);
+        s16 enemy_y = (s16)(enemies[k].y >> FIX16_FRAC_BITS);
 
-            // If within blast radius, deal 1 HP damage
-            if (dist < BOMB_BLAST_RADIUS)
-            {
-                enemies[k].hp -= 1;
-
-                // Check if enemy is defeated
-                if (enemies[k].hp <= 0)
-                {
-                    // Award half points (50) to the player who triggered the blast
-                    if (player == 1)
-                        score_p1 += 50;
-                    else
-                        score_p2 += 50;
-
-                    // Destroy enemy
-                    enemies[k].active = FALSE;
-                    SPR_releaseSprite(enemies[k].sprite);
-                    enemies[k].sprite = NULL;
-                }
-            }
-        }
-    }
+        // Calculate distance from impact point
+        s16 dx = enemy_x - bx;
+        s16 dy = enemy_y - by;
+        s16 dist = abs(dx) + abs(dy);  // Manhattan distance (faster than sqrt)
 
-    // Apply blast damage to large enemies
-    for (u8 k = 0; k < MAX_LARGE_ENEMIES; k++)
-    {
-        if (large_enemies[k].active)
+        // If within blast radius, deal 1 HP damage
+        if (dist < BOMB_BLAST_RADIUS)
         {
-            // Get position of this large enemy
-            s16 enemy_x = (s16)(large_enemies[k].x >> FIX16_FRAC_BITS);
-            s16 enemy_y = (s16)(large_enemies[k].y >> FIX16_FRAC_BITS);
+            enemies[k].hp -= 1;
 
-            // Calculate distance from impact point
-            s16 dx = enemy_x - bx;
-            s16 dy = enemy_y - by;
-            s16 dist = abs(dx) + abs(dy);  // Manhattan distance (faster than sqrt)
+            // Show hurt sprite (if the type has one)
+            enemies[k].hurt_timer = ENEMY_HURT_DURATION;
 
-            // If within blast radius, deal 1 HP damage
-            if (dist < BOMB_BLAST_RADIUS)
+            // Check if enemy is defeated
+            if (enemies[k].hp <= 0)
             {
-                large_enemies[k].hp -= 1;
-
-                // Show hurt sprite
-                large_enemies[k].hurt_timer = LARGE_ENEMY_HURT_DURATION;
+                // Award half points to the player who triggered the blast
+                addScore(player, enemies[k].type->blast_score);
 
-                // Check if large enemy is defeated
-                if (large_enemies[k].hp <= 0)
-                {
-                    // Award half points (100) to the player who triggered the blast
-                    if (player == 1)
-                        score_p1 += 100;
-                    else
-                        score_p2 += 100;
-
-                    // Destroy large enemy
-                    large_enemies[k].active = FALSE;
-                    SPR_releaseSprite(large_enemies[k].sprite);
-                    large_enemies[k].sprite = NULL;
-                }
+                // Destroy enemy; the last plane moves into this slot
+                destroyEnemy(k);
+                continue;
             }
         }
-    }
-}
-
-u8 shouldSpawnTruck(u16 wave)
-{
-    // First truck on wave 3
-    if (wave < 3) return FALSE;
 
-    // Waves 3-11: every 3 waves (3, 6, 9)
-    if (wave <= 11)
-    {
-        return (wave % 3) == 0;
-    }
-
-    // Waves 12-20: every 4 waves (12, 16, 20)
-    if (wave <= 20)
-    {
-        return (wave % 4) == 0;
+        k++;
     }
 
-    // After wave 20: every 4 waves (24, 28, 32...)
-    return (wave % 4) == 0;
+    blast_depth--;
+    PROF_END(PROF_BLAST_WAVE);
 }
 
 void spawnPowerupTruck()
@@ -667,50 +613,43 @@ void updatePowerupTruck()
 
             if (powerup_truck.from_left)
             {
-                powerup_truck.x = FIX16(-20);  // Start off left edge
-                powerup_truck.vx = TRUCK_SPEED;  // Move right
+                // Start off left edge, move right
+                startMotion(&powerup_truck.motion, FIX16(-20), TRUCK_SPEED, SCREEN_WIDTH + 20);
             }
             else
             {
-                powerup_truck.x = FIX16(SCREEN_WIDTH + 20);  // Start off right edge
-                powerup_truck.vx = -TRUCK_SPEED;  // Move left
+                // Start off right edge, move left
+                startMotion(&powerup_truck.motion, FIX16(SCREEN_WIDTH + 20), -TRUCK_SPEED, -20);
             }
 
             powerup_truck.active = TRUE;
+            powerup_truck.arrow_active = TRUE;
             powerup_truck.arrow_collected = FALSE;
             powerup_truck.arrow_y = FIX16(TRUCK_Y);
             powerup_truck.arrow_vy = FIX16(0);
 
-            // Create sprite (24x24, so offset by 12 horizontally and 12 vertically, flip horizontally based on direction)
-            s16 sprite_x = (s16)(powerup_truck.x >> FIX16_FRAC_BITS) - 12;
-            s16 sprite_y = TRUCK_Y - 12;
-
-            powerup_truck.sprite = SPR_addSprite(&sprite_truck,
-                                                  sprite_x,
-                                                  sprite_y,
-                                                  TILE_ATTR(PAL2, 0, FALSE, powerup_truck.from_left));
-            SPR_setDepth(powerup_truck.sprite, 0);
-
-            // Create arrow sprite on top of truck (24x24)
-            powerup_truck.arrow_sprite = SPR_addSprite(&sprite_truck_arrow,
-                                                        sprite_x,
-                                                        sprite_y,
-                                                        TILE_ATTR(PAL2, 0, FALSE, powerup_truck.from_left));
-            SPR_setDepth(powerup_truck.arrow_sprite, SPR_MIN_DEPTH);
+            // Truck and arrow sprites are added once they come into view
+            powerup_truck.sprite = NULL;
+            powerup_truck.arrow_sprite = NULL;
         }
         return;
     }
 
     if (!powerup_truck.active) return;
 
-    // Move truck
-    powerup_truck.x = powerup_truck.x + powerup_truck.vx;
+    s16 tx = (s16)(getMotionX(&powerup_truck.motion) >> FIX16_FRAC_BITS);
 
-    s16 tx = (s16)(powerup_truck.x >> FIX16_FRAC_BITS);
+    // A collected arrow runs at half rate under load (it just stays put on
+    // skipped ticks); while riding the truck it has to keep up with it
+    u8 step = powerup_truck.arrow_collected ? getThrottleStep(0) : 1;
 
     // Update arrow position
-    if (powerup_truck.arrow_sprite != NULL)
+    if (powerup_truck.arrow_active && step != 0)
     {
+        // Arrow follows the truck until collected (24x24, drawn on top of it)
+        s16 arrow_x = tx - 12;
+        s16 arrow_y = TRUCK_Y - 12;
+
         if (powerup_truck.arrow_collected)
         {
             // Arrow is moving upward independently with fixed X position
@@ -724,48 +663,69 @@ void updatePowerupTruck()
             if (distance_traveled < TRUCK_ARROW_DISTANCE)
             {
                 // Still moving upward
-                powerup_truck.arrow_y = powerup_truck.arrow_y + powerup_truck.arrow_vy;
+                powerup_truck.arrow_y = powerup_truck.arrow_y + powerup_truck.arrow_vy * step;
                 ay = (s16)(powerup_truck.arrow_y >> FIX16_FRAC_BITS);
             }
             else
             {
                 // Reached target distance, hold in place
-                powerup_truck.arrow_hold_timer++;
+                powerup_truck.arrow_hold_timer += step;
 
                 if (powerup_truck.arrow_hold_timer >= TRUCK_ARROW_HOLD_TIME)
                 {
                     // Hold time complete, remove arrow
-                    SPR_releaseSprite(powerup_truck.arrow_sprite);
-                    powerup_truck.arrow_sprite = NULL;
+                    powerup_truck.arrow_active = FALSE;
+                    releaseLayerSprite(&powerup_truck.arrow_sprite);
                     return;
                 }
             }
 
-            // Update arrow sprite position (fixed X, moving/holding Y)
-            SPR_setPosition(powerup_truck.arrow_sprite, ax - 12, ay - 12);
+            // Fixed X, moving/holding Y
+            arrow_x = ax - 12;
+            arrow_y = ay - 12;
+        }
+
+        // Only hold an arrow sprite while it is in view
+        if (!isBoxOnScreen(arrow_x, arrow_y, 24, 24))
+        {
+            releaseLayerSprite(&powerup_truck.arrow_sprite);
+        }
+        else if (powerup_truck.arrow_sprite == NULL)
+        {
+            powerup_truck.arrow_sprite = addLayerSprite(&sprite_truck_arrow,
+                                                         arrow_x,
+                                                         arrow_y,
+                                                         TILE_ATTR(PAL2, 0, FALSE, powerup_truck.from_left),
+                                                         LAYER_EFFECTS);
         }
         else
         {
-            // Arrow follows truck position
-            SPR_setPosition(powerup_truck.arrow_sprite, tx - 12, TRUCK_Y - 12);
+            SPR_setPosition(powerup_truck.arrow_sprite, arrow_x, arrow_y);
         }
     }
 
-    // Check if truck went off screen
-    if ((powerup_truck.from_left && tx > SCREEN_WIDTH + 20) ||
-        (!powerup_truck.from_left && tx < -20))
+    // Check if truck went off screen (exit tick was scheduled at spawn)
+    if (hasMotionExited(&powerup_truck.motion))
     {
-        // Truck left screen
+        // Truck left screen (clean up the arrow too if it still exists)
         powerup_truck.active = FALSE;
-        SPR_releaseSprite(powerup_truck.sprite);
-        powerup_truck.sprite = NULL;
-
-        // Clean up arrow sprite if it still exists
-        if (powerup_truck.arrow_sprite != NULL)
-        {
-            SPR_releaseSprite(powerup_truck.arrow_sprite);
-            powerup_truck.arrow_sprite = NULL;
-        }
+        powerup_truck.arrow_active = FALSE;
+        releaseLayerSprite(&powerup_truck.sprite);
+        releaseLayerSprite(&powerup_truck.arrow_sprite);
+    }
+    else if (!isBoxOnScreen(tx - 12, TRUCK_Y - 12, 24, 24))
+    {
+        // Still driving, but out of view
+        releaseLayerSprite(&powerup_truck.sprite);
+    }
+    else if (powerup_truck.sprite == NULL)
+    {
+        // Came into view: create sprite (24x24, flip horizontally based on direction)
+        powerup_truck.sprite = addLayerSprite(&sprite_truck,
+                                               tx - 12,
+                                               TRUCK_Y - 12,
+                                               TILE_ATTR(PAL2, 0, FALSE, powerup_truck.from_left),
+                                               LAYER_GROUND);
     }
     else
     {
@@ -774,21 +734,6 @@ void updatePowerupTruck()
     }
 }
 
-u8 shouldSpawnPolarBear(u16 wave)
-{
-    // First polar bear on wave 4
-    if (wave < 4) return FALSE;
-
-    // Waves 4-20: every 4 waves (4, 8, 12, 16, 20)
-    if (wave <= 20)
-    {
-        return (wave % 4) == 0;
-    }
-
-    // After wave 20: every 5 waves (25, 30, 35...)
-    return (wave % 5) == 0;
-}
-
 void spawnPolarBear()
 {
     // Don't spawn if already active or pending
@@ -822,48 +767,56 @@ void updatePolarBear()
 
             if (polar_bear.from_left)
             {
-                polar_bear.x = FIX16(-20);  // Start off left edge
-                polar_bear.vx = POLAR_BEAR_SPEED;  // Move right
+                // Start off left edge, move right
+                startMotion(&polar_bear.motion, FIX16(-20), POLAR_BEAR_SPEED, SCREEN_WIDTH + 20);
             }
             else
             {
-                polar_bear.x = FIX16(SCREEN_WIDTH + 20);  // Start off right edge
-                polar_bear.vx = -POLAR_BEAR_SPEED;  // Move left
+                // Start off right edge, move left
+                startMotion(&polar_bear.motion, FIX16(SCREEN_WIDTH + 20), -POLAR_BEAR_SPEED, -20);
             }
 
             polar_bear.active = TRUE;
 
-            // Create sprite (flip horizontally if coming from right)
-            s16 sprite_x = (s16)(polar_bear.x >> FIX16_FRAC_BITS) - 8;
-            s16 sprite_y = POLAR_BEAR_Y - 8;
-
-            polar_bear.sprite = SPR_addSprite(&sprite_polarbear,
-                                              sprite_x,
-                                              sprite_y,
-                                              TILE_ATTR(PAL1, 0, FALSE, polar_bear.from_left ? FALSE : TRUE));
+            // Sprite is added once the bear walks into view
+            polar_bear.sprite = NULL;
         }
         return;
     }
 
     if (!polar_bear.active) return;
 
-    // Move polar bear
-    polar_bear.x = polar_bear.x + polar_bear.vx;
-
-    s16 px = (s16)(polar_bear.x >> FIX16_FRAC_BITS);
+    s16 px = (s16)(getMotionX(&polar_bear.motion) >> FIX16_FRAC_BITS);
 
-    // Check if polar bear went off screen
-    if ((polar_bear.from_left && px > SCREEN_WIDTH + 20) ||
-        (!polar_bear.from_left && px < -20))
+    // Check if polar bear went off screen (exit tick is rescheduled by click boosts)
+    if (hasMotionExited(&polar_bear.motion))
     {
         // Polar bear left screen
         polar_bear.active = FALSE;
-        SPR_releaseSprite(polar_bear.sprite);
-        polar_bear.sprite = NULL;
+        releaseLayerSprite(&polar_bear.sprite);
+    }
+    else if (!isBoxOnScreen(px - 8, POLAR_BEAR_Y - 8, 16, 16))
+    {
+        // Still walking, but out of view
+        releaseLayerSprite(&polar_bear.sprite);
+    }
+    else if (polar_bear.sprite == NULL)
+    {
+        // Came into view: create sprite (flip horizontally if coming from right)
+        polar_bear.sprite = addLayerSprite(&sprite_polarbear,
+                                           px - 8,
+                                           POLAR_BEAR_Y - 8,
+                                           TILE_ATTR(PAL1, 0, FALSE, polar_bear.from_left ? FALSE : TRUE),
+                                           LAYER_GROUND);
+        polar_bear.draw_x = px - 8;
     }
     else
     {
-        // Update sprite position
-        SPR_setPosition(polar_bear.sprite, px - 8, POLAR_BEAR_Y - 8);
+        // Update sprite position only when the pixel changed (Y is fixed)
+        if (px - 8 != polar_bear.draw_x)
+        {
+            SPR_setPosition(polar_bear.sprite, px - 8, POLAR_BEAR_Y - 8);
+            polar_bear.draw_x = px - 8;
+        }
     }
 }
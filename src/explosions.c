@@ -1,5 +1,40 @@
 #include "explosions.h"
 #include "resources.h"
+#include "layers.h"
+#include "telemetry.h"
+#include "throttle.h"
+#include "governor.h"
+
+// Explosion tiles for every animation frame are loaded to VRAM once and shared
+// by all explosions: sprites are created without their own VRAM allocation
+// and simply pointed at the preloaded frame tiles.
+static u16** small_frame_tiles = NULL;
+static u16** big_frame_tiles = NULL;
+
+// First frame to show: the whole animation normally, or just the full
+// frame when the governor has turned explosion animation off
+static u8 getStartFrame()
+{
+    return (governor_level >= GOVERNOR_STATIC_EXPLOSIONS) ? EXPLOSION_STATIC_FRAME : 0;
+}
+
+static Sprite* addExplosionSprite(u8 big, s16 x, s16 y, u8 frame)
+{
+    const SpriteDefinition* def = big ? &sprite_explosion_big : &sprite_explosion;
+    s16 half = big ? 16 : 8;
+
+    Sprite* sprite = addLayerSpriteEx(def, x - half, y - half,
+                                      TILE_ATTR(PAL2, 0, FALSE, FALSE),
+                                      SPR_FLAG_AUTO_VISIBILITY | SPR_FLAG_AUTO_SPRITE_ALLOC,
+                                      LAYER_EFFECTS);
+    if (sprite != NULL)
+    {
+        if (frame != 0)
+            SPR_setFrame(sprite, frame);
+        SPR_setVRAMTileIndex(sprite, big ? big_frame_tiles[0][frame] : small_frame_tiles[0][frame]);
+    }
+    return sprite;
+}
 
 void initExplosions()
 {
@@ -9,6 +44,11 @@ void initExplosions()
         explosions[i].active = FALSE;
         explosions[i].sprite = NULL;
     }
+
+    // Preload all explosion frames (small animation first, then the merged one)
+    u16 num_tiles;
+    small_frame_tiles = SPR_loadAllFrames(&sprite_explosion, TILE_EXPLOSION_INDEX, &num_tiles);
+    big_frame_tiles = SPR_loadAllFrames(&sprite_explosion_big, TILE_EXPLOSION_INDEX + num_tiles, &num_tiles);
 }
 
 void updateExplosions()
@@ -17,37 +57,121 @@ void updateExplosions()
     {
         if (explosions[i].active)
         {
-            explosions[i].timer--;
+            // Half rate under load (a double step every other tick)
+            u8 step = getThrottleStep(i);
+            if (step == 0)
+                continue;
+
+            explosions[i].timer = (explosions[i].timer > step) ? explosions[i].timer - step : 0;
 
             if (explosions[i].timer == 0)
             {
                 // Time's up - remove the explosion
                 explosions[i].active = FALSE;
-                SPR_releaseSprite(explosions[i].sprite);
+                if (explosions[i].sprite != NULL)
+                    SPR_releaseSprite(explosions[i].sprite);
                 explosions[i].sprite = NULL;
             }
-            // No position update needed for static explosions
+            else
+            {
+                // Step the animation (flash, grow, full, fade), unless the
+                // governor has explosions hold a single frame
+                u8 frame = (EXPLOSION_DURATION - explosions[i].timer) >> EXPLOSION_FRAME_SHIFT;
+                if (frame != explosions[i].frame && explosions[i].sprite != NULL &&
+                    governor_level < GOVERNOR_STATIC_EXPLOSIONS)
+                {
+                    u16** frame_tiles = explosions[i].big ? big_frame_tiles : small_frame_tiles;
+                    explosions[i].frame = frame;
+                    SPR_setFrame(explosions[i].sprite, frame);
+                    SPR_setVRAMTileIndex(explosions[i].sprite, frame_tiles[0][frame]);
+                }
+            }
         }
     }
 }
 
+// Restart an existing explosion as a bigger one centered between it and (x, y)
+static void mergeExplosion(u8 i, s16 x, s16 y)
+{
+    explosions[i].x = (explosions[i].x + x) >> 1;
+    explosions[i].y = (explosions[i].y + y) >> 1;
+    explosions[i].timer = EXPLOSION_DURATION;
+    explosions[i].frame = getStartFrame();
+
+    if (!explosions[i].big)
+    {
+        // Swap to the 32x32 explosion
+        explosions[i].big = TRUE;
+        if (explosions[i].sprite != NULL)
+            SPR_releaseSprite(explosions[i].sprite);
+        explosions[i].sprite = addExplosionSprite(TRUE, explosions[i].x, explosions[i].y, explosions[i].frame);
+    }
+    else if (explosions[i].sprite != NULL)
+    {
+        SPR_setFrame(explosions[i].sprite, explosions[i].frame);
+        SPR_setVRAMTileIndex(explosions[i].sprite, big_frame_tiles[0][explosions[i].frame]);
+        SPR_setPosition(explosions[i].sprite, explosions[i].x - 16, explosions[i].y - 16);
+    }
+}
+
 void spawnExplosion(s16 x, s16 y)
 {
-    // Find an inactive explosion slot
+    s8 free_slot = -1;
+    s8 nearest = -1;
+    s16 nearest_dist = 0x7FFF;
+
     for (u8 i = 0; i < MAX_EXPLOSIONS; i++)
     {
         if (!explosions[i].active)
         {
-            explosions[i].x = x;
-            explosions[i].y = y;
-            explosions[i].active = TRUE;
-            explosions[i].timer = EXPLOSION_DURATION;
-
-            explosions[i].sprite = SPR_addSprite(&sprite_explosion,
-                                                  x - 8,  // Center the 16x16 sprite
-                                                  y - 8,
-                                                  TILE_ATTR(PAL2, 0, FALSE, FALSE));
-            break;  // Only spawn one
+            if (free_slot < 0)
+                free_slot = i;
+            continue;
+        }
+
+        s16 dist = abs(explosions[i].x - x) + abs(explosions[i].y - y);
+
+        // An explosion at most EXPLOSION_MERGE_AGE frames old and within
+        // EXPLOSION_MERGE_RADIUS absorbs this one (megabombs, chain reactions)
+        if (dist < EXPLOSION_MERGE_RADIUS &&
+            explosions[i].timer >= EXPLOSION_DURATION - EXPLOSION_MERGE_AGE)
+        {
+            mergeExplosion(i, x, y);
+            return;
+        }
+
+        if (dist < nearest_dist)
+        {
+            nearest_dist = dist;
+            nearest = i;
         }
     }
+
+    if (free_slot < 0)
+    {
+        // Pool is full - grow the nearest explosion if it is within twice the
+        // merge radius, otherwise drop the request and count the failure
+        if (nearest >= 0 && nearest_dist < EXPLOSION_MERGE_RADIUS * 2)
+            mergeExplosion(nearest, x, y);
+        else
+            telemetryAllocFailed();
+        return;
+    }
+
+    explosions[free_slot].x = x;
+    explosions[free_slot].y = y;
+    explosions[free_slot].active = TRUE;
+    explosions[free_slot].timer = EXPLOSION_DURATION;
+    explosions[free_slot].frame = getStartFrame();
+    explosions[free_slot].big = FALSE;
+    explosions[free_slot].sprite = addExplosionSprite(FALSE, x, y, explosions[free_slot].frame);
+}
+
+// Explosions that only dress up the scene (ground hits, megabomb debris);
+// the governor skips these first when frames are heavy
+void spawnCosmeticExplosion(s16 x, s16 y)
+{
+    if (governor_level >= GOVERNOR_NO_COSMETIC)
+        return;
+    spawnExplosion(x, y);
 }
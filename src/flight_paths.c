@@ -0,0 +1,57 @@
+// Generated by create_flight_paths.py from data/paths.txt - do not edit
+#include "flight_paths.h"
+
+static const s8 path_level[1] =
+{
+    0,
+};
+
+static const s8 path_weave[128] =
+{
+    38, 37, 38, 37, 37, 36, 36, 35, 34, 34, 33, 32, 30, 30, 29, 27,
+    26, 25, 23, 22, 20, 18, 17, 16, 13, 12, 10, 8, 7, 4, 3, 1,
+    -1, -3, -4, -7, -8, -10, -12, -13, -16, -17, -18, -20, -22, -23, -25, -26,
+    -27, -29, -30, -30, -32, -33, -34, -34, -35, -36, -36, -37, -37, -38, -37, -38,
+    -38, -37, -38, -37, -37, -36, -36, -35, -34, -34, -33, -32, -30, -30, -29, -27,
+    -26, -25, -23, -22, -20, -18, -17, -16, -13, -12, -10, -8, -7, -4, -3, -1,
+    1, 3, 4, 7, 8, 10, 12, 13, 16, 17, 18, 20, 22, 23, 25, 26,
+    27, 29, 30, 30, 32, 33, 34, 34, 35, 36, 36, 37, 37, 38, 37, 38,
+};
+
+static const s8 path_swoop[204] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 13, 20, 28, 34, 41, 47, 53,
+    57, 63, 67, 71, 74, 77, 80, 82, 84, 85, 86, 86, 86, 86, 85, 84,
+    82, 80, 77, 74, 71, 67, 63, 57, 53, 47, 41, 34, 28, 20, 13, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -4, -13, -20, -28, -34, -41, -47, -53,
+    -57, -63, -67, -71, -74, -77, -80, -82, -84, -85, -86, -86, -86, -86, -85, -84,
+    -82, -80, -77, -74, -71, -67, -63, -57, -53, -47, -41, -34, -28, -20, -13, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const s8 path_dive[141] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 9, 15, 20, 25, 30,
+    34, 40, 43, 47, 51, 55, 57, 61, 63, 66, 68, 69, 72, 73, 74, 76,
+    76, 76, 77, 77, 76, 76, 76, 74, 73, 72, 69, 68, 66, 63, 61, 57,
+    55, 51, 47, 43, 40, 34, 30, 25, 20, 15, 9, 3, 0,
+};
+
+const FlightPath flight_paths[FLIGHT_PATH_COUNT] =
+{
+    { path_level, 1, 0 },
+    { path_weave, 128, 0 },
+    { path_swoop, 204, 40 },
+    { path_dive, 141, 140 },
+};
@@ -0,0 +1,50 @@
+#include "governor.h"
+#include "perf.h"
+
+u8 governor_level = GOVERNOR_FULL;
+
+static u8 heavy_frames = 0;
+static u8 light_frames = 0;
+
+void initGovernor()
+{
+    governor_level = GOVERNOR_FULL;
+    heavy_frames = 0;
+    light_frames = 0;
+}
+
+// Once per frame, from the last frame's logic time. Only a sustained run of
+// heavy or light frames changes the level, so one busy frame (a megabomb)
+// doesn't make quality flicker.
+void updateGovernor()
+{
+    if (game_paused || game_over)
+        return;
+
+    if (perf_logic_lines >= GOVERNOR_HIGH_LINES)
+    {
+        light_frames = 0;
+        if (++heavy_frames >= GOVERNOR_RAISE_FRAMES)
+        {
+            heavy_frames = 0;
+            if (governor_level < GOVERNOR_LEVELS - 1)
+                governor_level++;
+        }
+    }
+    else if (perf_logic_lines < GOVERNOR_LOW_LINES)
+    {
+        heavy_frames = 0;
+        if (++light_frames >= GOVERNOR_LOWER_FRAMES)
+        {
+            light_frames = 0;
+            if (governor_level > GOVERNOR_FULL)
+                governor_level--;
+        }
+    }
+    else
+    {
+        // In between: hold the current level
+        heavy_frames = 0;
+        light_frames = 0;
+    }
+}
@@ -0,0 +1,36 @@
+#include "ground.h"
+#include "resources.h"
+
+// Igloos and cannons never move, so they are drawn as 2x2 tile blocks on
+// BG_A instead of taking hardware sprites. Positions are centers, and the
+// top-left corner (x - 8, y - 8) must sit on the 8 pixel tile grid.
+
+static void drawGroundBlock(const Image* image, u16 tile_index, s16 x, s16 y)
+{
+    VDP_setTileMapEx(BG_A, image->tilemap,
+                     TILE_ATTR_FULL(PAL1, FALSE, FALSE, FALSE, tile_index),
+                     (x - 8) >> 3, (y - 8) >> 3, 0, 0, 2, 2, CPU);
+}
+
+void initGroundTiles()
+{
+    // Load the igloo and cannon tiles once, right after the projectile layer tiles
+    VDP_loadTileSet(image_igloo.tileset, TILE_IGLOO_INDEX, DMA);
+    VDP_loadTileSet(image_cannon.tileset, TILE_CANNON_INDEX, DMA);
+}
+
+void drawIgloo(u8 index)
+{
+    drawGroundBlock(&image_igloo, TILE_IGLOO_INDEX, igloos[index].x, igloos[index].y);
+}
+
+void clearIgloo(u8 index)
+{
+    VDP_fillTileMapRect(BG_A, 0, (igloos[index].x - 8) >> 3, (igloos[index].y - 8) >> 3, 2, 2);
+}
+
+void drawCannons()
+{
+    drawGroundBlock(&image_cannon, TILE_CANNON_INDEX, CANNON_LEFT_X, CANNON_Y);
+    drawGroundBlock(&image_cannon, TILE_CANNON_INDEX, CANNON_RIGHT_X, CANNON_Y);
+}
@@ -1,8 +1,32 @@
 #include "hud.h"
+#include "text.h"
+#include "governor.h"
 #include <string.h>
 
+// Values currently shown, so rows are only rebuilt when something changed
+static u16 shown_wave = 0xFFFF;
+static u8 shown_igloos = 0xFF;
+static u16 shown_megabombs = 0xFFFF;
+static u32 shown_score_p1 = 0xFFFFFFFF;
+static u32 shown_score_p2 = 0xFFFFFFFF;
+static u16 shown_ammo_p1 = 0xFFFF;
+static u16 shown_ammo_p2 = 0xFFFF;
+static u16 shown_sprite_count = 0xFFFF;
+
 void drawHUD()
 {
+    // Under sustained load the governor has the HUD refreshed less often
+    static u8 refresh_wait = 0;
+    if (governor_level >= GOVERNOR_SLOW_HUD)
+    {
+        if (refresh_wait)
+        {
+            refresh_wait--;
+            return;
+        }
+        refresh_wait = GOVERNOR_HUD_INTERVAL - 1;
+    }
+
     char status[40];
     u8 igloos_alive = 0;
     for (u8 i = 0; i < NUM_IGLOOS; i++)
@@ -13,48 +37,88 @@ void drawHUD()
     // Get active sprite count from SGDK
     u16 sprite_count = SPR_getNumActiveSprite();
 
+    // Wave / igloos / megabombs row (same in both modes)
+    if (current_wave != shown_wave || igloos_alive != shown_igloos || megabombs != shown_megabombs)
+    {
+        shown_wave = current_wave;
+        shown_igloos = igloos_alive;
+        shown_megabombs = megabombs;
+
+        sprintf(status, "WAVE:%02d IGLOOS:%d BOMBS:%d ", current_wave, igloos_alive, megabombs);
+        putText(status, 1, 1);
+    }
+
     if (two_player_mode)
     {
         // 2-player HUD: show both scores and ammo
-        sprintf(status, "WAVE:%02d IGLOOS:%d BOMBS:%d", current_wave, igloos_alive, megabombs);
-        VDP_drawText(status, 1, 1);
-        sprintf(status, "P1:%lu AMMO:%d", score_p1, ammo_p1);
-        VDP_drawText(status, 1, 2);
-        sprintf(status, "P2:%lu AMMO:%d", score_p2, ammo_p2);
-        VDP_drawText(status, 1, 3);
-        sprintf(status, "SPRITES:%d/80", sprite_count);
-        VDP_drawText(status, 1, 4);
+        // Scores and ammo are BCD, drawn digit by digit into fixed fields
+        if (score_p1 != shown_score_p1 || ammo_p1 != shown_ammo_p1)
+        {
+            shown_score_p1 = score_p1;
+            shown_ammo_p1 = ammo_p1;
+            putText("P1:", 1, 2);
+            putBCD(score_p1, 8, 4, 2);
+            putText(" AMMO:", 12, 2);
+            putBCD(ammo_p1, 4, 18, 2);
+        }
+        if (score_p2 != shown_score_p2 || ammo_p2 != shown_ammo_p2)
+        {
+            shown_score_p2 = score_p2;
+            shown_ammo_p2 = ammo_p2;
+            putText("P2:", 1, 3);
+            putBCD(score_p2, 8, 4, 3);
+            putText(" AMMO:", 12, 3);
+            putBCD(ammo_p2, 4, 18, 3);
+        }
+        if (sprite_count != shown_sprite_count)
+        {
+            shown_sprite_count = sprite_count;
+            sprintf(status, "SPRITES:%d/80 ", sprite_count);
+            putText(status, 1, 4);
+        }
     }
     else
     {
         // 1-player HUD: show score and ammo
-        sprintf(status, "WAVE:%02d IGLOOS:%d BOMBS:%d", current_wave, igloos_alive, megabombs);
-        VDP_drawText(status, 1, 1);
-        sprintf(status, "SCORE:%lu AMMO:%d", score_p1, ammo_p1);
-        VDP_drawText(status, 1, 2);
-        sprintf(status, "SPRITES:%d/80", sprite_count);
-        VDP_drawText(status, 1, 3);
+        if (score_p1 != shown_score_p1 || ammo_p1 != shown_ammo_p1)
+        {
+            shown_score_p1 = score_p1;
+            shown_ammo_p1 = ammo_p1;
+            putText("SCORE:", 1, 2);
+            putBCD(score_p1, 8, 7, 2);
+            putText(" AMMO:", 15, 2);
+            putBCD(ammo_p1, 4, 21, 2);
+        }
+        if (sprite_count != shown_sprite_count)
+        {
+            shown_sprite_count = sprite_count;
+            sprintf(status, "SPRITES:%d/80 ", sprite_count);
+            putText(status, 1, 3);
+        }
     }
 }
 
 void drawGameOver()
 {
+    // The final screen never changes, so it is only built once
+    static u8 drawn = FALSE;
+    if (drawn) return;
+    drawn = TRUE;
+
     if (two_player_mode)
     {
-        char p1_score[40], p2_score[40];
-        VDP_drawText("    GAME OVER!    ", 11, 13);
-        VDP_drawText("  All Igloos Lost ", 11, 14);
-        sprintf(p1_score, " Player 1: %lu ", score_p1);
-        sprintf(p2_score, " Player 2: %lu ", score_p2);
-        VDP_drawText(p1_score, 11, 15);
-        VDP_drawText(p2_score, 11, 16);
+        putText("    GAME OVER!    ", 11, 13);
+        putText("  All Igloos Lost ", 11, 14);
+        putText(" Player 1: ", 11, 15);
+        putBCD(score_p1, 8, 22, 15);
+        putText(" Player 2: ", 11, 16);
+        putBCD(score_p2, 8, 22, 16);
     }
     else
     {
-        char final_score[40];
-        VDP_drawText("    GAME OVER!    ", 11, 14);
-        VDP_drawText("  All Igloos Lost ", 11, 15);
-        sprintf(final_score, " Final Score: %lu ", score_p1);
-        VDP_drawText(final_score, 11, 16);
+        putText("    GAME OVER!    ", 11, 14);
+        putText("  All Igloos Lost ", 11, 15);
+        putText(" Final Score: ", 11, 16);
+        putBCD(score_p1, 8, 25, 16);
     }
 }
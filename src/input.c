@@ -0,0 +1,60 @@
+#include "input.h"
+
+// Every input consumer reads pads[] instead of the joypad ports, so a tick
+// sees one consistent snapshot. Presses are also latched from the joypad
+// event handler (run during VBlank), so a tap that is released again before
+// the next sample still counts as a press.
+
+PadState pads[NUM_PADS];
+
+static u16 latched_presses[NUM_PADS];
+static u8 virtual_active[NUM_PADS];
+static u16 virtual_held[NUM_PADS];
+
+static void joyEvent(u16 joy, u16 changed, u16 state)
+{
+    if (joy < NUM_PADS)
+        latched_presses[joy] |= changed & state;
+}
+
+void initInput()
+{
+    for (u8 i = 0; i < NUM_PADS; i++)
+    {
+        pads[i].held = 0;
+        pads[i].pressed = 0;
+        pads[i].released = 0;
+        latched_presses[i] = 0;
+        virtual_active[i] = FALSE;
+    }
+
+    JOY_setEventHandler(joyEvent);
+}
+
+void updateInput()
+{
+    for (u8 i = 0; i < NUM_PADS; i++)
+    {
+        u16 previous = pads[i].held;
+        u16 held = virtual_active[i] ? virtual_held[i] : JOY_readJoypad(JOY_1 + i);
+        u16 latched = virtual_active[i] ? 0 : latched_presses[i];
+
+        pads[i].held = held;
+        pads[i].pressed = (held & ~previous) | latched;
+        pads[i].released = previous & ~held;
+        latched_presses[i] = 0;
+    }
+}
+
+// Buttons the pad will report from the next updateInput() on
+void setVirtualPad(u8 pad, u16 held)
+{
+    virtual_active[pad] = TRUE;
+    virtual_held[pad] = held;
+}
+
+// Hand the pad back to its joypad port
+void releaseVirtualPad(u8 pad)
+{
+    virtual_active[pad] = FALSE;
+}
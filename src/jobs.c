@@ -0,0 +1,93 @@
+#include "jobs.h"
+#include "perf.h"
+
+typedef struct {
+    JobFunc func;
+    u8 priority;
+    u16 deadline;  // Frame number after which the job must run
+} Job;
+
+// Pending jobs in posting order
+static Job jobs[MAX_JOBS];
+static u8 job_count = 0;
+static u16 frame = 0;
+
+void initJobs()
+{
+    job_count = 0;
+    frame = 0;
+}
+
+// Posting a job that is already queued keeps one entry (in its original
+// place) with the higher priority and the earlier deadline
+void postJob(JobFunc func, u8 priority, u16 max_delay)
+{
+    u16 deadline = frame + max_delay;
+
+    for (u8 i = 0; i < job_count; i++)
+    {
+        if (jobs[i].func == func)
+        {
+            if (priority < jobs[i].priority)
+                jobs[i].priority = priority;
+            if ((s16)(deadline - jobs[i].deadline) < 0)
+                jobs[i].deadline = deadline;
+            return;
+        }
+    }
+
+    if (job_count == MAX_JOBS)
+    {
+        // Queue is full - do the work now rather than lose it
+        func();
+        return;
+    }
+
+    jobs[job_count].func = func;
+    jobs[job_count].priority = priority;
+    jobs[job_count].deadline = deadline;
+    job_count++;
+}
+
+// Index of the next job to run: the oldest overdue job, otherwise the oldest
+// job with the best priority. Sets *overdue accordingly.
+static u8 pickJob(u8* overdue)
+{
+    u8 best = 0;
+    for (u8 i = 0; i < job_count; i++)
+    {
+        if ((s16)(frame - jobs[i].deadline) >= 0)
+        {
+            *overdue = TRUE;
+            return i;
+        }
+        if (jobs[i].priority < jobs[best].priority)
+            best = i;
+    }
+    *overdue = FALSE;
+    return best;
+}
+
+void runJobs()
+{
+    while (job_count)
+    {
+        u8 overdue;
+        u8 i = pickJob(&overdue);
+
+        // Out of time this frame: leave the rest for a later frame
+        if (!overdue && getFrameLinesLeft() < JOB_MIN_LINES)
+            break;
+
+        JobFunc func = jobs[i].func;
+
+        // Remove before running so the job can post follow-up work
+        job_count--;
+        for (u8 j = i; j < job_count; j++)
+            jobs[j] = jobs[j + 1];
+
+        func();
+    }
+
+    frame++;
+}
@@ -0,0 +1,52 @@
+#include "layers.h"
+#include "telemetry.h"
+
+// Every sprite belongs to one fixed render layer, and each layer has a single
+// depth value. The depth is set once when the sprite is added, which places it
+// after the sprites already in its layer (allocation order), so the sprite
+// engine's link order is always the layers concatenated front to back and
+// nothing is re-sorted afterwards.
+static const s16 layer_depth[NUM_LAYERS] =
+{
+    SPR_MIN_DEPTH,          // LAYER_HUD
+    SPR_MIN_DEPTH / 2,      // LAYER_EFFECTS
+    0,                      // LAYER_PLANES
+    SPR_MAX_DEPTH / 2       // LAYER_GROUND
+};
+
+Sprite* addLayerSprite(const SpriteDefinition* def, s16 x, s16 y, u16 attr, u8 layer)
+{
+    Sprite* sprite = SPR_addSprite(def, x, y, attr);
+    if (sprite != NULL)
+        SPR_setDepth(sprite, layer_depth[layer]);
+    else
+        telemetryAllocFailed();
+    return sprite;
+}
+
+Sprite* addLayerSpriteEx(const SpriteDefinition* def, s16 x, s16 y, u16 attr, u16 flags, u8 layer)
+{
+    Sprite* sprite = SPR_addSpriteEx(def, x, y, attr, flags);
+    if (sprite != NULL)
+        SPR_setDepth(sprite, layer_depth[layer]);
+    else
+        telemetryAllocFailed();
+    return sprite;
+}
+
+// Release a sprite if there is one and clear the pointer (entities only hold
+// a sprite while they are in view)
+void releaseLayerSprite(Sprite** sprite)
+{
+    if (*sprite != NULL)
+    {
+        SPR_releaseSprite(*sprite);
+        *sprite = NULL;
+    }
+}
+
+// TRUE if a box with its top-left corner at (x, y) overlaps the screen
+u8 isBoxOnScreen(s16 x, s16 y, s16 width, s16 height)
+{
+    return (x + width > 0 && x < SCREEN_WIDTH && y + height > 0 && y < SCREEN_HEIGHT);
+}
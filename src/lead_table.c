@@ -0,0 +1,16 @@
+// Generated by create_lead_table.py from inc/common.h - do not edit
+#include "lead_table.h"
+
+const u8 snowball_lead_ticks[LEAD_TABLE_SIZE] =
+{
+    2, 4, 7, 10, 12, 15, 18, 20, 23, 26, 28, 31, 34, 36, 39, 42,  // 0-127 px
+    44, 47, 50, 52, 55, 58, 60, 63, 66, 68, 71, 74, 76, 79, 82, 84,  // 128-255 px
+    87, 90, 92, 95, 98, 100, 103, 106, 108, 111, 114, 116,  // 256-351 px
+};
+
+const u8 snowball_lead_drop[LEAD_TABLE_SIZE] =
+{
+    0, 0, 0, 0, 1, 1, 2, 3, 4, 5, 6, 7, 9, 10, 12, 14,  // 0-127 px
+    15, 17, 19, 21, 24, 26, 28, 31, 34, 36, 39, 43, 45, 49, 53, 55,  // 128-255 px
+    59, 63, 66, 71, 75, 78, 83, 88, 91, 97, 102, 106,  // 256-351 px
+};
@@ -7,13 +7,25 @@
 #include "scoring.h"
 #include "hud.h"
 #include "explosions.h"
+#include "projectiles.h"
+#include "ground.h"
+#include "text.h"
+#include "perf.h"
+#include "throttle.h"
+#include "governor.h"
+#include "telemetry.h"
+#include "profile.h"
+#include "timestep.h"
+#include "jobs.h"
+#include "input.h"
+#include "ai.h"
 #include "resources.h"
 
 // Global game state (definitions)
 u8 two_player_mode = FALSE;
+u8 cpu_player2 = FALSE;
 u16 current_wave = 1;
 u8 enemies_spawned = 0;
-u8 large_enemies_spawned = 0;
 u8 wave_complete = FALSE;
 u8 game_over = FALSE;
 u8 game_paused = FALSE;
@@ -23,7 +35,7 @@ u16 ammo_p1 = 0;
 u16 ammo_p2 = 0;
 u16 megabombs = 0;
 u8 bonus_igloos_queued = 0;
-u32 next_bonus_threshold = 5000;
+u32 next_bonus_threshold = 0x5000;  // BCD
 u8 triple_shot_active_p1 = FALSE;
 u16 triple_shot_timer_p1 = 0;
 u8 triple_shot_active_p2 = FALSE;
@@ -35,12 +47,12 @@ u16 fast_shot_timer_p2 = 0;
 
 // Title screen state
 u8 title_screen_active = TRUE;
-u8 menu_selection = 0;  // 0 = 1 Player, 1 = 2 Players
+u8 menu_selection = 0;  // 0 = 1 Player, 1 = 2 Players, 2 = 1 Player + CPU
 
 // Global object pools (definitions)
 Missile missiles[MAX_MISSILES];
 Enemy enemies[MAX_ENEMIES];
-Enemy large_enemies[MAX_LARGE_ENEMIES];
+u8 enemy_count = 0;
 Bomb bombs[MAX_BOMBS];
 Igloo igloos[NUM_IGLOOS];
 PowerupTruck powerup_truck;
@@ -49,33 +61,40 @@ Explosion explosions[MAX_EXPLOSIONS];
 
 void drawTitleScreen()
 {
+    // Only redraw when the selection changed (static screen otherwise)
+    static s8 shown_selection = -1;
+    if (shown_selection == menu_selection) return;
+    shown_selection = menu_selection;
+
     // Draw title
-    VDP_drawText("     SNOWBALL DEFENSE     ", 7, 8);
-    VDP_drawText("                          ", 7, 9);
+    putText("     SNOWBALL DEFENSE     ", 7, 8);
+    putText("                          ", 7, 9);
 
     // Draw menu options with selection indicator
     if (menu_selection == 0)
-        VDP_drawText("      > 1 PLAYER <        ", 7, 12);
+        putText("      > 1 PLAYER <        ", 7, 12);
     else
-        VDP_drawText("        1 PLAYER          ", 7, 12);
+        putText("        1 PLAYER          ", 7, 12);
 
     if (menu_selection == 1)
-        VDP_drawText("      > 2 PLAYERS <       ", 7, 14);
+        putText("      > 2 PLAYERS <       ", 7, 14);
+    else
+        putText("        2 PLAYERS         ", 7, 14);
+
+    if (menu_selection == 2)
+        putText("      > 1P + CPU <        ", 7, 16);
     else
-        VDP_drawText("        2 PLAYERS         ", 7, 14);
+        putText("        1P + CPU          ", 7, 16);
 
     // Draw instructions
-    VDP_drawText("   UP/DOWN: Select        ", 7, 18);
-    VDP_drawText("   START: Begin Game      ", 7, 19);
+    putText("   UP/DOWN: Select        ", 7, 18);
+    putText("   START: Begin Game      ", 7, 19);
 }
 
 void handleTitleScreenInput()
 {
-    u16 joy1 = JOY_readJoypad(JOY_1);
-    static u16 prev_joy1 = 0;
-
     // Check for button press (not held)
-    u16 pressed = joy1 & ~prev_joy1;
+    u16 pressed = pads[0].pressed;
 
     // UP - Move selection up
     if (pressed & BUTTON_UP)
@@ -87,15 +106,16 @@ void handleTitleScreenInput()
     // DOWN - Move selection down
     if (pressed & BUTTON_DOWN)
     {
-        if (menu_selection < 1)
+        if (menu_selection < 2)
             menu_selection++;
     }
 
     // START - Confirm selection and start game
     if (pressed & BUTTON_START)
     {
-        // Set game mode based on selection
-        two_player_mode = (menu_selection == 1) ? TRUE : FALSE;
+        // Set game mode based on selection (the CPU partner plays player 2)
+        two_player_mode = (menu_selection != 0) ? TRUE : FALSE;
+        cpu_player2 = (menu_selection == 2) ? TRUE : FALSE;
 
         // Exit title screen
         title_screen_active = FALSE;
@@ -103,9 +123,8 @@ void handleTitleScreenInput()
         // Clear screen for game
         VDP_clearPlane(BG_A, TRUE);
         VDP_clearPlane(BG_B, TRUE);
+        resetTextLayer();
     }
-
-    prev_joy1 = joy1;
 }
 
 void initGame()
@@ -116,6 +135,7 @@ void initGame()
     // Clear background planes
     VDP_clearPlane(BG_A, TRUE);
     VDP_clearPlane(BG_B, TRUE);
+    resetTextLayer();
 
     // Set background color to dark blue
     PAL_setColor(0, RGB24_TO_VDPCOLOR(0x001040));
@@ -129,39 +149,44 @@ void initGame()
     // Initialize sprite engine
     SPR_init();
 
+    // Load igloo and cannon tiles before anything draws them
+    initGroundTiles();
+
     // Initialize subsystems
     initPlayer();
     initWeapons();
     initEnemies();
     initExplosions();
+    initProjectileLayer();
+    initJobs();
+    initGovernor();
+    initAI();
 
     // Start background music (loop infinitely)
     XGM_setLoopNumber(-1);
   //  XGM_startPlay(bgm_music);
 
     // Initialize igloos (5 evenly spaced along bottom, centered)
+    // X is rounded to a multiple of 8 so the igloo lands on the tile grid
     s16 igloo_spacing = SCREEN_WIDTH / (NUM_IGLOOS + 1);
     for (u8 i = 0; i < NUM_IGLOOS; i++)
     {
-        igloos[i].x = igloo_spacing * (i + 1);
+        igloos[i].x = (igloo_spacing * (i + 1) + 4) & ~7;
         igloos[i].y = CANNON_Y;
         igloos[i].alive = TRUE;
 
-        igloos[i].sprite = SPR_addSprite(&sprite_igloo,
-                                          igloos[i].x - 8,
-                                          igloos[i].y - 8,
-                                          TILE_ATTR(PAL1, 0, FALSE, FALSE));
+        drawIgloo(i);
     }
 
     // Initialize ammunition
     if (two_player_mode)
     {
-        ammo_p1 = 25;  // Two-player mode: each player starts with 25
-        ammo_p2 = 25;
+        ammo_p1 = 0x25;  // Two-player mode: each player starts with 25 (BCD)
+        ammo_p2 = 0x25;
     }
     else
     {
-        ammo_p1 = 50;  // Single-player mode: start with 50
+        ammo_p1 = 0x50;  // Single-player mode: start with 50 (BCD)
         ammo_p2 = 0;   // Player 2 not used in single-player
     }
 
@@ -169,20 +194,133 @@ void initGame()
     megabombs = 3;
 }
 
+// HUD text refresh, run as a low priority job
+static void refreshHUD()
+{
+    PROF_BEGIN(PROF_DRAW_HUD);
+    drawHUD();
+    PROF_END(PROF_DRAW_HUD);
+}
+
+// Start the wave after a completed one, run as a job once the game over check
+// has had its turn (no new wave once every igloo is gone)
+static void startNextWave()
+{
+    if (game_over)
+        return;
+
+    spawnWave();
+
+    // Check if we should spawn a truck on this wave
+    if (wave_params.flags & WAVE_FLAG_TRUCK)
+    {
+        postJob(spawnPowerupTruck, JOB_PRIORITY_NORMAL, JOB_DELAY_GAME);
+    }
+
+    // Check if we should spawn a polar bear on this wave
+    if (wave_params.flags & WAVE_FLAG_BEAR)
+    {
+        postJob(spawnPolarBear, JOB_PRIORITY_NORMAL, JOB_DELAY_GAME);
+    }
+}
+
+// Advance the game by one fixed logic tick (input, movement, collisions, waves)
+static void gameTick()
+{
+    // Let the CPU partner set player 2's buttons, then sample the pads once for this tick
+    driveAI();
+    updateInput();
+
+    // Handle input (always check for pause button)
+    handleInput();
+
+    // Only update game state if not paused
+    if (!game_paused)
+    {
+        // Apply a half rate change decided this frame (between step pairs only)
+        syncThrottle();
+
+        // Update crosshair position
+        updateCrosshair();
+
+        // Update missiles
+        updateMissiles();
+        telemetryMark(TELEMETRY_PHASE_MISSILES);
+
+        // Update powerups
+        updatePowerups();
+
+        // Bring in planes from the wave's entry queue
+        updateWaveEntries();
+
+        // Update enemies
+        PROF_BEGIN(PROF_UPDATE_ENEMIES);
+        updateEnemies();
+        PROF_END(PROF_UPDATE_ENEMIES);
+        telemetryMark(TELEMETRY_PHASE_ENEMIES);
+
+        // Update bombs
+        updateBombs();
+        telemetryMark(TELEMETRY_PHASE_BOMBS);
+
+        // Update powerup truck
+        updatePowerupTruck();
+
+        // Update polar bear
+        updatePolarBear();
+
+        // Update explosions
+        updateExplosions();
+
+        // Check collisions
+        checkCollisions();
+        telemetryMark(TELEMETRY_PHASE_COLLISIONS);
+
+        // If wave is complete, spawn next wave after a brief delay
+        if (wave_complete && enemies_spawned == 0)
+        {
+            // Restore one bonus igloo if available and needed (at most one per wave),
+            // then check for game over AFTER attempting to restore it, and only
+            // then start the next wave. All deferred; same priority keeps them
+            // in this order.
+            postJob(restoreBonusIgloo, JOB_PRIORITY_NORMAL, JOB_DELAY_GAME);
+            postJob(checkGameOver, JOB_PRIORITY_NORMAL, JOB_DELAY_GAME);
+            postJob(startNextWave, JOB_PRIORITY_NORMAL, JOB_DELAY_GAME);
+
+            // The jobs take it from here (don't post them again while they wait)
+            wave_complete = FALSE;
+        }
+
+        game_ticks++;
+    }
+}
+
 int main()
 {
     // Initialize VDP early for title screen
     VDP_setScreenWidth320();
     VDP_clearPlane(BG_A, TRUE);
     VDP_clearPlane(BG_B, TRUE);
+    resetTextLayer();
     PAL_setColor(0, RGB24_TO_VDPCOLOR(0x001040));
 
+    // Start recording frame telemetry
+    initTelemetry();
+
+    // Pad snapshots and the joypad event latch
+    initInput();
+
     // Main game loop
     while(1)
     {
+        // Mark the start of this frame's work
+        perfFrameStart();
+        telemetryFrameStart();
+
         if (title_screen_active)
         {
-            // Title screen mode
+            // Title screen mode (one input sample per frame)
+            updateInput();
             handleTitleScreenInput();
             drawTitleScreen();
         }
@@ -193,78 +331,55 @@ int main()
             if (!game_initialized)
             {
                 initGame();
+                initTimestep();
                 spawnWave();
                 game_initialized = TRUE;
             }
 
-            if (!game_over)
-            {
-                // Handle input (always check for pause button)
-                handleInput();
-
-                // Only update game state if not paused
-                if (!game_paused)
-                {
-                    // Update crosshair position
-                    updateCrosshair();
-
-                    // Update missiles
-                    updateMissiles();
-
-                    // Update powerups
-                    updatePowerups();
-
-                    // Update enemies
-                    updateEnemies();
-
-                    // Update large enemies
-                    updateLargeEnemies();
+            // Halve low-priority updates if last frame came close to running over,
+            // and step quality down (or back up) if the load has stayed high (or low)
+            updateThrottle();
+            updateGovernor();
 
-                    // Update bombs
-                    updateBombs();
+            // CPU partner looks over a few more bombs and planes for its next target
+            updateAI();
 
-                    // Update powerup truck
-                    updatePowerupTruck();
-
-                    // Update polar bear
-                    updatePolarBear();
-
-                    // Update explosions
-                    updateExplosions();
-
-                    // Check collisions
-                    checkCollisions();
-
-                    // If wave is complete, spawn next wave after a brief delay
-                    if (wave_complete && enemies_spawned == 0 && large_enemies_spawned == 0)
-                    {
-                        // Restore one bonus igloo if available and needed (at most one per wave)
-                        restoreBonusIgloo();
-
-                        // Check for game over AFTER attempting to restore bonus igloo
-                        checkGameOver();
-
-                        spawnWave();
+            // Run the logic ticks owed since last frame (usually one; more to catch
+            // up after an overrun or on PAL). Only the result of the last one is drawn.
+            u8 ticks = getPendingTicks();
+            u8 ticks_run = 0;
+            while (ticks && !game_over)
+            {
+                gameTick();
+                ticks--;
+                ticks_run++;
+            }
+            telemetryLogicEnd(ticks_run);
 
-                        // Check if we should spawn a truck on this wave
-                        if (shouldSpawnTruck(current_wave))
-                        {
-                            spawnPowerupTruck();
-                        }
+            // Scanlines spent on game logic this frame
+            perfLogicEnd();
 
-                        // Check if we should spawn a polar bear on this wave
-                        if (shouldSpawnPolarBear(current_wave))
-                        {
-                            spawnPolarBear();
-                        }
-                    }
+            if (!game_over)
+            {
+                // Draw snowballs and bombs into the BG_B projectile layer
+                if (!game_paused)
+                {
+                    PROF_BEGIN(PROF_PROJECTILE_LAYER);
+                    updateProjectileLayer();
+                    PROF_END(PROF_PROJECTILE_LAYER);
                 }
 
-                // Display HUD (always show even when paused)
-                drawHUD();
-
                 // Update all sprites (always render even when paused)
+                PROF_BEGIN(PROF_SPRITE_UPDATE);
                 SPR_update();
+                PROF_END(PROF_SPRITE_UPDATE);
+                telemetryMark(TELEMETRY_PHASE_RENDER);
+
+                // Display HUD (always show even when paused); it's refreshed with
+                // the other deferred work in whatever time is left this frame
+                postJob(refreshHUD, JOB_PRIORITY_LOW, JOB_DELAY_HUD);
+                runJobs();
+                telemetryMark(TELEMETRY_PHASE_JOBS);
             }
             else
             {
@@ -273,6 +388,18 @@ int main()
             }
         }
 
+        // Close this frame's profiler totals (profiling builds only)
+        PROF_FRAME_END();
+
+        // Sample frame counters and draw the performance overlay if it's on
+        perfFrameEnd();
+
+        // Queue this frame's text changes (sent during VBlank)
+        flushText();
+
+        // Record this frame (after all DMA for the next VBlank is queued)
+        telemetryFrameEnd();
+
         // Wait for VBlank (60 FPS sync)
         SYS_doVBlankProcess();
     }
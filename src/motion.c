@@ -0,0 +1,60 @@
+#include "motion.h"
+#include "timestep.h"
+
+// Work out the first tick at which the pixel X is past exit_x
+// (greater moving right, less moving left)
+static void scheduleExit(LinearMotion* motion)
+{
+    s32 distance;
+    s32 speed;
+
+    if (motion->vx > 0)
+    {
+        distance = ((s32)(motion->exit_x + 1) << FIX16_FRAC_BITS) - motion->x0;
+        speed = motion->vx;
+    }
+    else if (motion->vx < 0)
+    {
+        distance = motion->x0 - (((s32)motion->exit_x << FIX16_FRAC_BITS) - 1);
+        speed = -motion->vx;
+    }
+    else
+    {
+        motion->exit_tick = MOTION_NEVER;
+        return;
+    }
+
+    // Round up: the exit is the first tick that is fully past the edge.
+    // One division per spawn or speed change.
+    if (distance <= 0)
+        motion->exit_tick = motion->start_tick;
+    else
+        motion->exit_tick = motion->start_tick + (u32)((distance + speed - 1) / speed);
+}
+
+void startMotion(LinearMotion* motion, fix16 x, fix16 vx, s16 exit_x)
+{
+    motion->x0 = x;
+    motion->vx = vx;
+    motion->start_tick = game_ticks;
+    motion->exit_x = exit_x;
+    scheduleExit(motion);
+}
+
+void setMotionVelocity(LinearMotion* motion, fix16 vx)
+{
+    // Re-anchor at the current position so the new speed applies from now on
+    startMotion(motion, getMotionX(motion), vx, motion->exit_x);
+}
+
+fix16 getMotionX(const LinearMotion* motion)
+{
+    // Stop counting at the exit tick so a late read can't overflow
+    u32 now = (game_ticks < motion->exit_tick) ? game_ticks : motion->exit_tick;
+    return motion->x0 + (fix16)((s32)motion->vx * (s32)(now - motion->start_tick));
+}
+
+u8 hasMotionExited(const LinearMotion* motion)
+{
+    return game_ticks >= motion->exit_tick;
+}
@@ -0,0 +1,143 @@
+#include "perf.h"
+#include "text.h"
+#include "governor.h"
+
+// Frame performance counters and the optional on-screen overlay.
+// Measuring is a couple of register reads per frame; formatting and drawing
+// only happen while the overlay is visible.
+
+u8 perf_overlay_visible = FALSE;
+u16 perf_logic_lines = 0;
+u16 perf_frame_lines = 0;
+u8 perf_frame_load = 0;
+u32 perf_lag_frames = 0;
+
+static u16 frame_start_phase = 0;   // Lines from the last VBlank start to the frame start
+static u16 frame_budget_lines = 0;  // Lines from frame start until the next VBlank
+static u32 frame_start_vtimer = 0;  // VBlanks counted when the frame started
+static u16 dma_bytes = 0;
+static u32 sprite_overflow_frames = 0;
+static u32 sprite_collision_frames = 0;
+static u8 refresh_timer = 0;
+
+// Scanlines per frame (including VBlank) for the current video mode
+static u16 getFrameLines()
+{
+    return SYS_isPAL() ? 313 : 262;
+}
+
+// Lines since the most recent VBlank started
+static u16 getVBlankPhase()
+{
+    s16 lines = VDP_getAdjustedVCounter() - VDP_getScreenHeight();
+    if (lines < 0)
+        lines += getFrameLines();
+    return lines;
+}
+
+// VBlank count and line within it, read so the two agree
+static u16 readFramePosition(u32* frames)
+{
+    u16 phase;
+    do
+    {
+        *frames = vtimer;
+        phase = getVBlankPhase();
+    } while (*frames != vtimer);
+    return phase;
+}
+
+void perfFrameStart()
+{
+    u32 now;
+    u16 phase = readFramePosition(&now);
+
+    // More than one VBlank since the last frame means we missed at least one
+    if (frame_start_vtimer != 0 && now - frame_start_vtimer > 1)
+        perf_lag_frames += now - frame_start_vtimer - 1;
+    frame_start_vtimer = now;
+    frame_start_phase = phase;
+
+    // VBlank starts right after the last displayed line
+    frame_budget_lines = getFrameLines() - phase;
+}
+
+// Scanlines since perfFrameStart()
+static u16 getElapsedLines()
+{
+    // The V-counter wraps every frame, so whole frames are counted from the
+    // VBlanks that have passed since the start (a frame can overrun by several)
+    u32 frames;
+    u16 phase = readFramePosition(&frames);
+    s32 lines = (s32)(frames - frame_start_vtimer) * getFrameLines() + phase - frame_start_phase;
+    if (lines < 0)
+        return 0;
+    return (lines > 0xFFFF) ? 0xFFFF : lines;
+}
+
+// Scanlines left before VBlank (0 once the frame has overrun)
+u16 getFrameLinesLeft()
+{
+    // Past a VBlank the frame has overrun, whatever the V-counter says
+    if (vtimer != frame_start_vtimer)
+        return 0;
+
+    u16 elapsed = getElapsedLines();
+    return (elapsed < frame_budget_lines) ? frame_budget_lines - elapsed : 0;
+}
+
+void perfLogicEnd()
+{
+    perf_logic_lines = getElapsedLines();
+}
+
+void perfFrameEnd()
+{
+    // Everything done this frame (logic, HUD, sprite update)
+    perf_frame_lines = getElapsedLines();
+    u16 frame_load = ((u32)perf_frame_lines * 100) / frame_budget_lines;
+    perf_frame_load = (frame_load > 255) ? 255 : frame_load;
+
+    // DMA queued so far this frame (sent at the next VBlank)
+    dma_bytes = DMA_getQueueTransferSize();
+
+    // Sprite overflow / collision flags clear when the status port is read,
+    // so read it once per frame and keep counts
+    u16 status = GET_VDP_STATUS(VDP_SPROVER_FLAG | VDP_SPRCOLLISION_FLAG);
+    if (status & VDP_SPROVER_FLAG)
+        sprite_overflow_frames++;
+    if (status & VDP_SPRCOLLISION_FLAG)
+        sprite_collision_frames++;
+
+    if (!perf_overlay_visible)
+        return;
+
+    if (refresh_timer)
+    {
+        refresh_timer--;
+        return;
+    }
+    refresh_timer = PERF_OVERLAY_REFRESH - 1;
+
+    char line[41];
+    u16 load = ((u32)perf_logic_lines * 100) / getFrameLines();
+    sprintf(line, "CPU:%3d%% LOGIC:%3d ALL:%3d GOV:%d    ", load, perf_logic_lines, perf_frame_lines,
+            governor_level);
+    putText(line, 1, PERF_OVERLAY_ROW);
+    sprintf(line, "LAG:%5lu DMA:%5d OVF:%4lu COL:%4lu", perf_lag_frames, dma_bytes,
+            sprite_overflow_frames, sprite_collision_frames);
+    putText(line, 1, PERF_OVERLAY_ROW + 1);
+}
+
+void togglePerfOverlay()
+{
+    perf_overlay_visible = !perf_overlay_visible;
+    refresh_timer = 0;
+
+    if (!perf_overlay_visible)
+    {
+        // Blank the overlay rows once; nothing is drawn while hidden
+        putText("                                      ", 1, PERF_OVERLAY_ROW);
+        putText("                                      ", 1, PERF_OVERLAY_ROW + 1);
+    }
+}
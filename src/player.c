@@ -2,6 +2,11 @@
 #include "weapons.h"
 #include "collision.h"
 #include "resources.h"
+#include "layers.h"
+#include "ground.h"
+#include "perf.h"
+#include "profile.h"
+#include "input.h"
 
 // Player crosshair positions
 s16 crosshair1_x = SCREEN_WIDTH / 2;
@@ -12,39 +17,37 @@ s16 crosshair2_y = SCREEN_HEIGHT / 2;
 // Sprites
 Sprite* crosshair1_sprite = NULL;
 Sprite* crosshair2_sprite = NULL;
-Sprite* cannon_left_sprite = NULL;
-Sprite* cannon_right_sprite = NULL;
 
-// Previous button states (for edge detection)
-u16 prev_joy1 = 0;
-u16 prev_joy2 = 0;
+// Last crosshair positions written to the sprites (skip SAT refresh when still)
+static s16 crosshair1_draw_x, crosshair1_draw_y;
+static s16 crosshair2_draw_x, crosshair2_draw_y;
 
 void initPlayer()
 {
+    // Remember where the crosshairs start so updateCrosshair() can skip unchanged frames
+    crosshair1_draw_x = crosshair1_x;
+    crosshair1_draw_y = crosshair1_y;
+    crosshair2_draw_x = crosshair2_x;
+    crosshair2_draw_y = crosshair2_y;
+
     // Load crosshair sprites (16x16)
-    crosshair1_sprite = SPR_addSprite(&sprite_crosshair,
-                                       crosshair1_x - 8,
-                                       crosshair1_y - 8,
-                                       TILE_ATTR(PAL1, 0, FALSE, FALSE));
+    crosshair1_sprite = addLayerSprite(&sprite_crosshair,
+                                        crosshair1_x - 8,
+                                        crosshair1_y - 8,
+                                        TILE_ATTR(PAL1, 0, FALSE, FALSE),
+                                        LAYER_HUD);
 
     if (two_player_mode)
     {
-        crosshair2_sprite = SPR_addSprite(&sprite_crosshair,
-                                           crosshair2_x - 8,
-                                           crosshair2_y - 8,
-                                           TILE_ATTR(PAL1, 0, FALSE, FALSE));
+        crosshair2_sprite = addLayerSprite(&sprite_crosshair,
+                                            crosshair2_x - 8,
+                                            crosshair2_y - 8,
+                                            TILE_ATTR(PAL1, 0, FALSE, FALSE),
+                                            LAYER_HUD);
     }
 
-    // Load cannon sprites (16x16 each)
-    cannon_left_sprite = SPR_addSprite(&sprite_cannon,
-                                        CANNON_LEFT_X - 8,
-                                        CANNON_Y - 8,
-                                        TILE_ATTR(PAL1, 0, FALSE, FALSE));
-
-    cannon_right_sprite = SPR_addSprite(&sprite_cannon,
-                                         CANNON_RIGHT_X - 8,
-                                         CANNON_Y - 8,
-                                         TILE_ATTR(PAL1, 0, FALSE, FALSE));
+    // Draw cannons (16x16 each) as background tiles
+    drawCannons();
 }
 
 void updateCrosshair()
@@ -53,7 +56,7 @@ void updateCrosshair()
     if (game_paused) return;
 
     // Player 1 input (JOY_1)
-    u16 joy1 = JOY_readJoypad(JOY_1);
+    u16 joy1 = pads[0].held;
 
     // Determine speed based on B button
     s16 speed1 = (joy1 & BUTTON_B) ? CROSSHAIR_SPEED_BOOST : CROSSHAIR_SPEED_NORMAL;
@@ -78,13 +81,18 @@ void updateCrosshair()
     if (crosshair1_y > SCREEN_HEIGHT - 16)
         crosshair1_y = SCREEN_HEIGHT - 16;
 
-    // Update Player 1 sprite position
-    SPR_setPosition(crosshair1_sprite, crosshair1_x - 8, crosshair1_y - 8);
+    // Update Player 1 sprite position (only when it moved)
+    if (crosshair1_x != crosshair1_draw_x || crosshair1_y != crosshair1_draw_y)
+    {
+        SPR_setPosition(crosshair1_sprite, crosshair1_x - 8, crosshair1_y - 8);
+        crosshair1_draw_x = crosshair1_x;
+        crosshair1_draw_y = crosshair1_y;
+    }
 
     // Player 2 input (JOY_2) - only in 2-player mode
     if (two_player_mode)
     {
-        u16 joy2 = JOY_readJoypad(JOY_2);
+        u16 joy2 = pads[1].held;
 
         // Determine speed based on B button
         s16 speed2 = (joy2 & BUTTON_B) ? CROSSHAIR_SPEED_BOOST : CROSSHAIR_SPEED_NORMAL;
@@ -109,18 +117,24 @@ void updateCrosshair()
         if (crosshair2_y > SCREEN_HEIGHT - 16)
             crosshair2_y = SCREEN_HEIGHT - 16;
 
-        // Update Player 2 sprite position
-        SPR_setPosition(crosshair2_sprite, crosshair2_x - 8, crosshair2_y - 8);
+        // Update Player 2 sprite position (only when it moved)
+        if (crosshair2_x != crosshair2_draw_x || crosshair2_y != crosshair2_draw_y)
+        {
+            SPR_setPosition(crosshair2_sprite, crosshair2_x - 8, crosshair2_y - 8);
+            crosshair2_draw_x = crosshair2_x;
+            crosshair2_draw_y = crosshair2_y;
+        }
     }
 }
 
 void handleInput()
 {
-    // Player 1 input
-    u16 joy1 = JOY_readJoypad(JOY_1);
+    // Player 1 input (this tick's snapshot)
+    u16 held1 = pads[0].held;
+    u16 pressed1 = pads[0].pressed;
 
     // Check for Start button press (edge detection - toggle pause)
-    if ((joy1 & BUTTON_START) && !(prev_joy1 & BUTTON_START))
+    if (pressed1 & BUTTON_START)
     {
         game_paused = !game_paused;
     }
@@ -129,7 +143,7 @@ void handleInput()
     if (!game_paused)
     {
         // Check for A button press (edge detection - only fire once per press)
-        if ((joy1 & BUTTON_A) && !(prev_joy1 & BUTTON_A))
+        if (pressed1 & BUTTON_A)
         {
             // Check if clicking on powerup truck first
             checkPowerupTruckClick(crosshair1_x, crosshair1_y, 1);
@@ -140,21 +154,35 @@ void handleInput()
         }
 
         // Check for C button press (edge detection - trigger megabomb)
-        if ((joy1 & BUTTON_C) && !(prev_joy1 & BUTTON_C))
+        if (pressed1 & BUTTON_C)
         {
             triggerMegabomb(1);  // Player 1 triggers megabomb
         }
     }
+    else
+    {
+        // Hold A and press B while paused to toggle the performance overlay
+        if ((held1 & BUTTON_A) && (pressed1 & BUTTON_B))
+        {
+            togglePerfOverlay();
+        }
 
-    prev_joy1 = joy1;
+#ifdef PROFILE
+        // Hold A and press C while paused to toggle the profiler page
+        if ((held1 & BUTTON_A) && (pressed1 & BUTTON_C))
+        {
+            toggleProfilePage();
+        }
+#endif
+    }
 
     // Player 2 input (only in 2-player mode)
     if (two_player_mode)
     {
-        u16 joy2 = JOY_readJoypad(JOY_2);
+        u16 pressed2 = pads[1].pressed;
 
         // Check for Start button press (edge detection - toggle pause)
-        if ((joy2 & BUTTON_START) && !(prev_joy2 & BUTTON_START))
+        if (pressed2 & BUTTON_START)
         {
             game_paused = !game_paused;
         }
@@ -163,7 +191,7 @@ void handleInput()
         if (!game_paused)
         {
             // Check for A button press (edge detection - only fire once per press)
-            if ((joy2 & BUTTON_A) && !(prev_joy2 & BUTTON_A))
+            if (pressed2 & BUTTON_A)
             {
                 // Check if clicking on powerup truck first
                 checkPowerupTruckClick(crosshair2_x, crosshair2_y, 2);
@@ -174,12 +202,10 @@ void handleInput()
             }
 
             // Check for C button press (edge detection - trigger megabomb)
-            if ((joy2 & BUTTON_C) && !(prev_joy2 & BUTTON_C))
+            if (pressed2 & BUTTON_C)
             {
                 triggerMegabomb(2);  // Player 2 triggers megabomb
             }
         }
-
-        prev_joy2 = joy2;
     }
 }
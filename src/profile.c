@@ -0,0 +1,159 @@
+#include "profile.h"
+
+#ifdef PROFILE
+
+#include "text.h"
+
+static const char* const scope_names[PROF_SCOPES] =
+{
+    "checkCollisions",
+    "applyBlastWave",
+    "fireSingleMissile",
+    "spawnWave",
+    "updateEnemies",
+    "updateProjLayer",
+    "drawHUD",
+    "SPR_update"
+};
+
+// Current frame
+static u16 start_line[PROF_SCOPES];
+static u8 depth[PROF_SCOPES];
+static u16 frame_lines[PROF_SCOPES];
+static u8 frame_calls[PROF_SCOPES];
+
+// Current window (only frames where the scope ran)
+static u16 window_min[PROF_SCOPES];
+static u16 window_max[PROF_SCOPES];
+static u32 window_sum[PROF_SCOPES];
+static u8 window_runs[PROF_SCOPES];
+static u8 window_frames = 0;
+
+// Last completed window
+static u16 report_min[PROF_SCOPES];
+static u16 report_avg[PROF_SCOPES];
+static u16 report_max[PROF_SCOPES];
+static u8 report_runs[PROF_SCOPES];
+
+static u8 page_visible = FALSE;
+
+void profBegin(u8 id)
+{
+    if (depth[id]++ == 0)
+        start_line[id] = VDP_getAdjustedVCounter();
+    frame_calls[id]++;
+}
+
+void profEnd(u8 id)
+{
+    if (--depth[id] != 0)
+        return;
+
+    // The frame starts inside VBlank, so the V-counter may wrap to line 0
+    s16 lines = VDP_getAdjustedVCounter() - start_line[id];
+    if (lines < 0)
+        lines += SYS_isPAL() ? 313 : 262;
+    frame_lines[id] += lines;
+}
+
+static void resetWindow()
+{
+    for (u8 i = 0; i < PROF_SCOPES; i++)
+    {
+        window_min[i] = 0xFFFF;
+        window_max[i] = 0;
+        window_sum[i] = 0;
+        window_runs[i] = 0;
+    }
+}
+
+static void drawPage()
+{
+    char line[41];
+
+    putText("SCOPE              MIN  AVG  MAX RUNS", 1, PROFILE_PAGE_ROW);
+    for (u8 i = 0; i < PROF_SCOPES; i++)
+    {
+        sprintf(line, "%-17s %4d %4d %4d %4d", scope_names[i],
+                report_min[i], report_avg[i], report_max[i], report_runs[i]);
+        putText(line, 1, PROFILE_PAGE_ROW + 1 + i);
+    }
+}
+
+static void publishWindow()
+{
+    char line[64];
+
+    for (u8 i = 0; i < PROF_SCOPES; i++)
+    {
+        report_runs[i] = window_runs[i];
+        if (window_runs[i])
+        {
+            report_min[i] = window_min[i];
+            report_max[i] = window_max[i];
+            report_avg[i] = window_sum[i] / window_runs[i];
+        }
+        else
+        {
+            report_min[i] = 0;
+            report_avg[i] = 0;
+            report_max[i] = 0;
+        }
+
+        // Scanline costs over the window, to the emulator's debug log
+        if (window_runs[i])
+        {
+            sprintf(line, "PROF %s min %d avg %d max %d runs %d/%d", scope_names[i],
+                    report_min[i], report_avg[i], report_max[i], window_runs[i], PROFILE_WINDOW);
+            KLog(line);
+        }
+    }
+
+    if (page_visible)
+        drawPage();
+}
+
+void profFrameEnd()
+{
+    // Start a new window
+    if (window_frames == 0)
+        resetWindow();
+
+    for (u8 i = 0; i < PROF_SCOPES; i++)
+    {
+        if (frame_calls[i])
+        {
+            u16 lines = frame_lines[i];
+            if (lines < window_min[i]) window_min[i] = lines;
+            if (lines > window_max[i]) window_max[i] = lines;
+            window_sum[i] += lines;
+            window_runs[i]++;
+        }
+        frame_lines[i] = 0;
+        frame_calls[i] = 0;
+    }
+
+    if (++window_frames == PROFILE_WINDOW)
+    {
+        publishWindow();
+        window_frames = 0;
+    }
+}
+
+void toggleProfilePage()
+{
+    page_visible = !page_visible;
+
+    if (page_visible)
+    {
+        drawPage();
+    }
+    else
+    {
+        // Blank the page rows once
+        for (u8 i = 0; i <= PROF_SCOPES; i++)
+            putText("                                      ", 1, PROFILE_PAGE_ROW + i);
+    }
+}
+
+#endif // PROFILE
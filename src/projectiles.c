@@ -0,0 +1,262 @@
+#include "projectiles.h"
+#include "telemetry.h"
+
+// Snowballs and bombs are small, so instead of giving each one a hardware
+// sprite they are plotted into RAM tiles that back a region of BG_B.
+// Each frame only the cells covered by a projectile get a tile; the tile data
+// goes up in one DMA and only tilemap cells whose entry changed are rewritten.
+// Everything is queued and transferred during VBlank by SYS_doVBlankProcess().
+
+// Cells are packed as (row << CELL_ROW_SHIFT) | col
+#define CELL_ROW_SHIFT 6
+#define CELL_COL_MASK ((1 << CELL_ROW_SHIFT) - 1)
+
+// Shape rows are 8 pixels of 4bpp color (leftmost pixel in the high nibble),
+// using PAL2 color indexes so both shapes can share one palette per tile
+#define SNOWBALL_ROWS 8
+#define SNOWBALL_OFFSET_X (-4)
+#define SNOWBALL_OFFSET_Y (-4)
+
+#define BOMB_ROWS 13
+#define BOMB_OFFSET_X (-4)
+#define BOMB_OFFSET_Y (-2)  // Art starts 2 rows into the old 8x16 sprite at (x - 4, y - 4)
+
+static const u32 snowball_shape[SNOWBALL_ROWS] =
+{
+    0x00444400,
+    0x04444440,
+    0x44444444,
+    0x44444444,
+    0x44444444,
+    0x44444444,
+    0x04444440,
+    0x00444400
+};
+
+static const u32 bomb_shape[BOMB_ROWS] =
+{
+    0x01111110,
+    0x14444441,
+    0x14444441,
+    0x01111110,
+    0x00144100,
+    0x01444410,
+    0x15555551,
+    0x15555551,
+    0x14444441,
+    0x14444441,
+    0x01555510,
+    0x01555510,
+    0x00111100
+};
+
+// Opaque pixel masks, built once from the shapes
+static u32 snowball_mask[SNOWBALL_ROWS];
+static u32 bomb_mask[BOMB_ROWS];
+
+// RAM copy of the tiles for this frame (slot N is VRAM tile TILE_PROJECTILE_INDEX + N)
+static u32 tiles[PROJ_MAX_TILES][8];
+
+// Slot + 1 of the tile covering each cell this frame (0 = empty)
+static u8 cell_slot[PROJ_LAYER_ROWS][PROJ_LAYER_COLS];
+
+// Cells covered this frame and last frame
+static u16 cell_lists[2][PROJ_MAX_TILES];
+static u16 cell_counts[2];
+static u8 current_list = 0;
+
+// What BG_B currently shows in the playfield, and the dirty span of each row
+static u16 plane_mirror[PROJ_LAYER_ROWS][PROJ_LAYER_COLS];
+static s8 dirty_min[PROJ_LAYER_ROWS];
+static s8 dirty_max[PROJ_LAYER_ROWS];
+
+u16 projectile_tiles_used = 0;
+u16 projectile_tile_overflows = 0;
+
+static u32 buildMask(u32 row)
+{
+    u32 mask = 0;
+    for (u8 n = 0; n < 8; n++)
+    {
+        if (row & (0xFUL << (n * 4)))
+            mask |= 0xFUL << (n * 4);
+    }
+    return mask;
+}
+
+void initProjectileLayer()
+{
+    for (u8 i = 0; i < SNOWBALL_ROWS; i++)
+        snowball_mask[i] = buildMask(snowball_shape[i]);
+    for (u8 i = 0; i < BOMB_ROWS; i++)
+        bomb_mask[i] = buildMask(bomb_shape[i]);
+
+    // BG_B has just been cleared, so the layer starts out empty
+    memset(cell_slot, 0, sizeof(cell_slot));
+    memset(plane_mirror, 0, sizeof(plane_mirror));
+    for (u8 row = 0; row < PROJ_LAYER_ROWS; row++)
+        dirty_min[row] = -1;
+
+    cell_counts[0] = 0;
+    cell_counts[1] = 0;
+    current_list = 0;
+    projectile_tiles_used = 0;
+    projectile_tile_overflows = 0;
+}
+
+// Get the RAM tile covering a cell, allocating a cleared one on first use this frame.
+// Returns NULL if the cell is outside the layer or all tiles are in use.
+static u32* getCellTile(s16 col, s16 row)
+{
+    if (col < 0 || col >= PROJ_LAYER_COLS || row < 0 || row >= PROJ_LAYER_ROWS)
+        return NULL;
+
+    u8 slot = cell_slot[row][col];
+    if (slot)
+        return tiles[slot - 1];
+
+    u16 count = cell_counts[current_list];
+    if (count >= PROJ_MAX_TILES)
+    {
+        projectile_tile_overflows++;
+        telemetryAllocFailed();
+        return NULL;
+    }
+
+    u32* tile = tiles[count];
+    memset(tile, 0, 32);
+
+    cell_slot[row][col] = count + 1;
+    cell_lists[current_list][count] = (row << CELL_ROW_SHIFT) | col;
+    cell_counts[current_list] = count + 1;
+    return tile;
+}
+
+// Plot a shape with its top-left pixel at (x, y)
+static void plotShape(s16 x, s16 y, const u32* shape, const u32* mask, u8 rows)
+{
+    s16 col = x >> 3;
+    u8 shift = (x & 7) << 2;
+    u8 r = 0;
+
+    while (r < rows)
+    {
+        s16 py = y + r;
+        s16 row = py >> 3;
+        u8 line = py & 7;
+
+        // Number of shape rows that fall inside this tile row
+        u8 lines = 8 - line;
+        if (lines > rows - r)
+            lines = rows - r;
+
+        u32* left = getCellTile(col, row);
+        u32* right = shift ? getCellTile(col + 1, row) : NULL;
+
+        for (u8 k = 0; k < lines; k++)
+        {
+            u32 data = shape[r + k];
+            u32 opaque = mask[r + k];
+
+            if (left)
+                left[line + k] = (left[line + k] & ~(opaque >> shift)) | (data >> shift);
+            if (right)
+                right[line + k] = (right[line + k] & ~(opaque << (32 - shift))) | (data << (32 - shift));
+        }
+
+        r += lines;
+    }
+}
+
+static void setCell(u16 cell, u16 tile)
+{
+    u8 row = cell >> CELL_ROW_SHIFT;
+    u8 col = cell & CELL_COL_MASK;
+
+    if (plane_mirror[row][col] == tile)
+        return;
+
+    plane_mirror[row][col] = tile;
+
+    if (dirty_min[row] < 0)
+    {
+        dirty_min[row] = col;
+        dirty_max[row] = col;
+    }
+    else if (col < dirty_min[row])
+        dirty_min[row] = col;
+    else if (col > dirty_max[row])
+        dirty_max[row] = col;
+}
+
+void updateProjectileLayer()
+{
+    u8 previous_list = current_list;
+    current_list ^= 1;
+
+    // Forget last frame's cell assignments (only the cells that were used)
+    u16* previous_cells = cell_lists[previous_list];
+    u16 previous_count = cell_counts[previous_list];
+    for (u16 i = 0; i < previous_count; i++)
+    {
+        u16 cell = previous_cells[i];
+        cell_slot[cell >> CELL_ROW_SHIFT][cell & CELL_COL_MASK] = 0;
+    }
+    cell_counts[current_list] = 0;
+
+    // Plot snowballs
+    for (u8 i = 0; i < MAX_MISSILES; i++)
+    {
+        if (missiles[i].active)
+        {
+            s16 mx = (s16)(missiles[i].x >> FIX16_FRAC_BITS);
+            s16 my = (s16)(missiles[i].y >> FIX16_FRAC_BITS);
+            plotShape(mx + SNOWBALL_OFFSET_X, my + SNOWBALL_OFFSET_Y, snowball_shape, snowball_mask, SNOWBALL_ROWS);
+        }
+    }
+
+    // Plot bombs
+    for (u8 i = 0; i < MAX_BOMBS; i++)
+    {
+        if (bombs[i].active)
+        {
+            s16 bx = (s16)(bombs[i].x >> FIX16_FRAC_BITS);
+            s16 by = (s16)(bombs[i].y >> FIX16_FRAC_BITS);
+            plotShape(bx + BOMB_OFFSET_X, by + BOMB_OFFSET_Y, bomb_shape, bomb_mask, BOMB_ROWS);
+        }
+    }
+
+    // Point covered cells at their tiles
+    u16* cells = cell_lists[current_list];
+    u16 count = cell_counts[current_list];
+    for (u16 i = 0; i < count; i++)
+    {
+        setCell(cells[i], TILE_ATTR_FULL(PAL2, FALSE, FALSE, FALSE, TILE_PROJECTILE_INDEX + i));
+    }
+
+    // Blank cells that were covered last frame but not this one
+    for (u16 i = 0; i < previous_count; i++)
+    {
+        u16 cell = previous_cells[i];
+        if (!cell_slot[cell >> CELL_ROW_SHIFT][cell & CELL_COL_MASK])
+            setCell(cell, 0);
+    }
+
+    // Queue the tile data as a single transfer
+    if (count)
+        VDP_loadTileData(tiles[0], TILE_PROJECTILE_INDEX, count, DMA_QUEUE);
+
+    // Queue one transfer per dirty row span
+    for (u8 row = 0; row < PROJ_LAYER_ROWS; row++)
+    {
+        if (dirty_min[row] >= 0)
+        {
+            u8 x = dirty_min[row];
+            VDP_setTileMapDataRect(BG_B, &plane_mirror[row][x], x, row,
+                                   dirty_max[row] - x + 1, 1, PROJ_LAYER_COLS, DMA_QUEUE);
+            dirty_min[row] = -1;
+        }
+    }
+
+    projectile_tiles_used = count;
+}
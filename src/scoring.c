@@ -1,31 +1,42 @@
 #include "scoring.h"
-#include "resources.h"
+#include "ground.h"
+#include "bcd.h"
+
+// Add packed BCD points to a player's score
+void addScore(u8 player, u32 points)
+{
+    if (player == 1)
+        score_p1 = bcdAdd(score_p1, points);
+    else
+        score_p2 = bcdAdd(score_p2, points);
+}
 
 void checkBonusIgloo()
 {
     // In two-player mode, use the higher score of the two players
     u32 check_score = two_player_mode ? (score_p1 > score_p2 ? score_p1 : score_p2) : score_p1;
 
-    // Check if we've crossed the threshold
-    if (check_score >= next_bonus_threshold)
+    // Check if we've crossed the threshold (BCD compares like binary);
+    // a deferred check may have several to catch up on
+    while (check_score >= next_bonus_threshold)
     {
         bonus_igloos_queued++;
 
         // Calculate next threshold based on current threshold
-        if (next_bonus_threshold < 20000)
+        if (next_bonus_threshold < 0x20000)
         {
             // Up to 20000: every 5000 points (5000, 10000, 15000, 20000)
-            next_bonus_threshold += 5000;
+            next_bonus_threshold = bcdAdd(next_bonus_threshold, 0x5000);
         }
-        else if (next_bonus_threshold < 50000)
+        else if (next_bonus_threshold < 0x50000)
         {
             // 20000 to 50000: every 7500 points (27500, 35000, 42500, 50000)
-            next_bonus_threshold += 7500;
+            next_bonus_threshold = bcdAdd(next_bonus_threshold, 0x7500);
         }
         else
         {
             // After 50000: every 10000 points (60000, 70000, ...)
-            next_bonus_threshold += 10000;
+            next_bonus_threshold = bcdAdd(next_bonus_threshold, 0x10000);
         }
     }
 }
@@ -58,10 +69,7 @@ void restoreBonusIgloo()
             {
                 // Restore this igloo
                 igloos[i].alive = TRUE;
-                igloos[i].sprite = SPR_addSprite(&sprite_igloo,
-                                                  igloos[i].x - 8,
-                                                  igloos[i].y - 8,
-                                                  TILE_ATTR(PAL1, 0, FALSE, FALSE));
+                drawIgloo(i);
                 bonus_igloos_queued--;
                 break;  // Only restore one igloo per wave
             }
@@ -0,0 +1,127 @@
+#include "telemetry.h"
+#include "projectiles.h"
+#include "enemies.h"
+#include "throttle.h"
+#include "governor.h"
+#include <string.h>
+
+// Frame telemetry ring buffer (layout documented in telemetry.h)
+
+TelemetryBuffer telemetry;
+
+static TelemetryRecord* current = NULL;
+static u8 alloc_failures = 0;
+static u32 start_vtimer = 0;  // VBlanks counted at the START mark
+
+// Store the V-counter and the VBlanks since the START mark, read so the two agree
+static void storeMark(u8 phase)
+{
+    u32 frames;
+    u16 line;
+    do
+    {
+        frames = vtimer;
+        line = VDP_getAdjustedVCounter();
+    } while (frames != vtimer);
+
+    if (phase == TELEMETRY_PHASE_START)
+        start_vtimer = frames;
+    frames -= start_vtimer;
+
+    current->marks[phase] = line;
+    current->mark_vblanks[phase] = (frames > 0xFF) ? 0xFF : frames;
+}
+
+void initTelemetry()
+{
+    memset(&telemetry, 0, sizeof(telemetry));
+    memcpy(telemetry.magic, TELEMETRY_MAGIC, 4);
+    telemetry.version = TELEMETRY_VERSION;
+    telemetry.record_size = sizeof(TelemetryRecord);
+    telemetry.record_count = TELEMETRY_RECORDS;
+}
+
+void telemetryFrameStart()
+{
+    current = &telemetry.records[telemetry.head];
+
+    // Phases that get skipped this frame (title, pause, game over) stay unmarked
+    for (u8 i = 0; i < TELEMETRY_PHASES; i++)
+    {
+        current->marks[i] = TELEMETRY_NO_MARK;
+        current->mark_vblanks[i] = 0;
+    }
+    current->ticks = 0;
+
+    storeMark(TELEMETRY_PHASE_START);
+    alloc_failures = 0;
+}
+
+// Phases inside the logic ticks keep the first tick's mark; the time of any
+// catch-up ticks goes to the LOGIC phase instead of the first tick's phases
+void telemetryMark(u8 phase)
+{
+    if (current->marks[phase] == TELEMETRY_NO_MARK)
+        storeMark(phase);
+}
+
+// After the frame's logic ticks
+void telemetryLogicEnd(u8 ticks)
+{
+    current->ticks = ticks;
+    storeMark(TELEMETRY_PHASE_LOGIC);
+}
+
+void telemetryAllocFailed()
+{
+    if (alloc_failures < 0xFF)
+        alloc_failures++;
+}
+
+void telemetryFrameEnd()
+{
+    u8 i;
+    u8 count;
+
+    storeMark(TELEMETRY_PHASE_END);
+    current->frame = telemetry.frames;
+    current->wave = current_wave;
+
+    count = 0;
+    for (i = 0; i < MAX_MISSILES; i++)
+        if (missiles[i].active) count++;
+    current->missiles = count;
+
+    count = 0;
+    for (i = 0; i < enemy_count; i++)
+        if (enemies[i].type == &enemy_types[ENEMY_TYPE_LARGE]) count++;
+    current->enemies = enemy_count - count;
+    current->large_enemies = count;
+
+    count = 0;
+    for (i = 0; i < MAX_BOMBS; i++)
+        if (bombs[i].active) count++;
+    current->bombs = count;
+
+    count = 0;
+    for (i = 0; i < MAX_EXPLOSIONS; i++)
+        if (explosions[i].active) count++;
+    current->explosions = count;
+
+    current->sprites = SPR_getNumActiveSprite();
+    current->alloc_failures = alloc_failures;
+    current->dma_bytes = DMA_getQueueTransferSize();
+    current->projectile_tiles = projectile_tiles_used;
+
+    current->flags = 0;
+    if (title_screen_active) current->flags |= TELEMETRY_FLAG_TITLE;
+    if (game_paused) current->flags |= TELEMETRY_FLAG_PAUSED;
+    if (game_over) current->flags |= TELEMETRY_FLAG_GAME_OVER;
+    if (SYS_isPAL()) current->flags |= TELEMETRY_FLAG_PAL;
+    if (throttle_active) current->flags |= TELEMETRY_FLAG_THROTTLED;
+    current->flags |= governor_level << TELEMETRY_GOVERNOR_SHIFT;
+
+    // Publish the record
+    telemetry.head = (telemetry.head + 1) & (TELEMETRY_RECORDS - 1);
+    telemetry.frames++;
+}
@@ -0,0 +1,103 @@
+#include "text.h"
+
+// Retained-mode text on BG_A. A RAM mirror holds the tilemap entries currently
+// shown; putText() only touches cells whose character changed, and flushText()
+// queues one VRAM transfer per dirty row span, sent during VBlank.
+// Text must stay off the ground rows (igloos/cannons share BG_A there).
+
+static u16 text_mirror[TEXT_ROWS][TEXT_COLS];
+static s8 dirty_min[TEXT_ROWS];
+static s8 dirty_max[TEXT_ROWS];
+static u16 text_basetile;
+
+void resetTextLayer()
+{
+    // Call after BG_A has been cleared: the mirror starts out blank
+    memset(text_mirror, 0, sizeof(text_mirror));
+    for (u8 row = 0; row < TEXT_ROWS; row++)
+        dirty_min[row] = -1;
+
+    // Same tiles and attributes VDP_drawText() would use
+    text_basetile = TILE_ATTR_FULL(VDP_getTextPalette(), VDP_getTextPriority(), FALSE, FALSE, TILE_FONT_INDEX);
+}
+
+void putText(const char* str, u16 x, u16 y)
+{
+    if (y >= TEXT_ROWS)
+        return;
+
+    u16* cell = &text_mirror[y][x];
+    s8 first = -1;
+    s8 last = -1;
+
+    while (*str && x < TEXT_COLS)
+    {
+        u16 tile = text_basetile + (u8)(*str - 32);
+        if (*cell != tile)
+        {
+            *cell = tile;
+            if (first < 0)
+                first = x;
+            last = x;
+        }
+        cell++;
+        str++;
+        x++;
+    }
+
+    if (first < 0)
+        return;
+
+    // Grow the row's dirty span
+    if (dirty_min[y] < 0)
+    {
+        dirty_min[y] = first;
+        dirty_max[y] = last;
+    }
+    else
+    {
+        if (first < dirty_min[y])
+            dirty_min[y] = first;
+        if (last > dirty_max[y])
+            dirty_max[y] = last;
+    }
+}
+
+// Draw a packed BCD number left-aligned in a field of 'digits' cells.
+// Each nibble maps straight to a digit tile; leading zeros become blanks
+// at the end of the field so a shrinking number leaves nothing behind.
+void putBCD(u32 value, u8 digits, u16 x, u16 y)
+{
+    char str[9];
+    u8 len = 0;
+    u8 started = FALSE;
+
+    for (s8 shift = (digits - 1) * 4; shift >= 0; shift -= 4)
+    {
+        u8 nibble = (value >> shift) & 0xF;
+        if (nibble || started || shift == 0)
+        {
+            str[len++] = '0' + nibble;
+            started = TRUE;
+        }
+    }
+    while (len < digits)
+        str[len++] = ' ';
+    str[len] = 0;
+
+    putText(str, x, y);
+}
+
+void flushText()
+{
+    for (u8 row = 0; row < TEXT_ROWS; row++)
+    {
+        if (dirty_min[row] >= 0)
+        {
+            u8 x = dirty_min[row];
+            VDP_setTileMapDataRect(BG_A, &text_mirror[row][x], x, row,
+                                   dirty_max[row] - x + 1, 1, TEXT_COLS, DMA_QUEUE);
+            dirty_min[row] = -1;
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#include "throttle.h"
+#include "perf.h"
+#include "timestep.h"
+
+u8 throttle_active = FALSE;
+
+static u8 throttle_wanted = FALSE;
+
+// Once per frame, before the logic ticks: last frame's load predicts this one
+void updateThrottle()
+{
+    if (!throttle_wanted && perf_frame_load >= THROTTLE_ON_LOAD)
+        throttle_wanted = TRUE;
+    else if (throttle_wanted && perf_frame_load < THROTTLE_OFF_LOAD)
+        throttle_wanted = FALSE;
+}
+
+// Once per tick, before anything steps. Half rate only starts or stops on an
+// even tick, where every entity has just finished a skip/double step pair,
+// so switching never leaves one a tick ahead or behind.
+void syncThrottle()
+{
+    if (!(game_ticks & 1))
+        throttle_active = throttle_wanted;
+}
+
+// Ticks a low-priority entity should advance this tick:
+// 1 at full rate, otherwise 0 or 2 on alternating ticks
+u8 getThrottleStep(u8 index)
+{
+    if (!throttle_active)
+        return 1;
+    return ((game_ticks + index) & 1) ? 0 : 2;
+}
@@ -0,0 +1,44 @@
+#include "timestep.h"
+
+// Logic ticks are paid for by elapsed VBlanks rather than by loop iterations,
+// so the game keeps real-time speed when a frame overruns (the next frame runs
+// extra ticks) and on PAL (one extra tick every 5 frames).
+
+u32 game_ticks = 0;
+
+static u32 last_vtimer = 0;
+static u16 accumulator = 0;
+static u16 units_per_vblank = TIMESTEP_UNITS_PER_SECOND / 60;
+
+void initTimestep()
+{
+    units_per_vblank = TIMESTEP_UNITS_PER_SECOND / (SYS_isPAL() ? 50 : 60);
+    last_vtimer = vtimer;
+    accumulator = 0;
+    game_ticks = 0;
+}
+
+u8 getPendingTicks()
+{
+    u32 now = vtimer;
+    u32 elapsed = now - last_vtimer;
+    last_vtimer = now;
+
+    // A long stall (loading, debugger) would otherwise overflow the accumulator
+    if (elapsed > MAX_CATCHUP_TICKS)
+        elapsed = MAX_CATCHUP_TICKS;
+    accumulator += elapsed * units_per_vblank;
+
+    u8 ticks = 0;
+    while (accumulator >= TICK_UNITS && ticks < MAX_CATCHUP_TICKS)
+    {
+        accumulator -= TICK_UNITS;
+        ticks++;
+    }
+
+    // Too far behind to catch up: drop the rest instead of spiraling
+    if (ticks == MAX_CATCHUP_TICKS && accumulator >= TICK_UNITS)
+        accumulator = 0;
+
+    return ticks;
+}
@@ -0,0 +1,346 @@
+// Generated by create_wave_table.py from data/waves.txt - do not edit
+#include "wave_table.h"
+#include "flight_paths.h"
+
+const WaveParams wave_table[WAVE_TABLE_LENGTH] =
+{
+    { 3, 0, FIX16(0.30), 15992, 0, (1 << FLIGHT_PATH_LEVEL) },  // Wave 1, drop chance 1/1000
+    { 3, 0, FIX16(0.30), 7992, 0, (1 << FLIGHT_PATH_LEVEL) },  // Wave 2, drop chance 2/1000
+    { 3, 0, FIX16(0.30), 5325, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) },  // Wave 3, drop chance 3/1000
+    { 4, 0, FIX16(0.30), 3992, WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) },  // Wave 4, drop chance 4/1000
+    { 4, 1, FIX16(0.30), 3192, 0, (1 << FLIGHT_PATH_LEVEL) },  // Wave 5, drop chance 5/1000
+    { 4, 1, FIX16(0.30), 2659, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) },  // Wave 6, drop chance 6/1000
+    { 4, 1, FIX16(0.30), 2278, 0, (1 << FLIGHT_PATH_LEVEL) },  // Wave 7, drop chance 7/1000
+    { 5, 1, FIX16(0.30), 1992, WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) },  // Wave 8, drop chance 8/1000
+    { 5, 1, FIX16(0.30), 1770, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) },  // Wave 9, drop chance 9/1000
+    { 5, 1, FIX16(0.35), 1592, 0, (1 << FLIGHT_PATH_LEVEL) },  // Wave 10, drop chance 10/1000
+    { 5, 1, FIX16(0.35), 1447, 0, (1 << FLIGHT_PATH_LEVEL) },  // Wave 11, drop chance 11/1000
+    { 5, 1, FIX16(0.35), 1325, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) },  // Wave 12, drop chance 12/1000
+    { 5, 1, FIX16(0.35), 1223, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) },  // Wave 13, drop chance 13/1000
+    { 5, 1, FIX16(0.35), 1135, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) },  // Wave 14, drop chance 14/1000
+    { 5, 2, FIX16(0.35), 1059, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) },  // Wave 15, drop chance 15/1000
+    { 6, 2, FIX16(0.35), 992, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) },  // Wave 16, drop chance 16/1000
+    { 6, 2, FIX16(0.35), 933, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) },  // Wave 17, drop chance 17/1000
+    { 6, 2, FIX16(0.35), 881, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) },  // Wave 18, drop chance 18/1000
+    { 6, 2, FIX16(0.35), 834, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) },  // Wave 19, drop chance 19/1000
+    { 6, 2, FIX16(0.37), 792, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 20, drop chance 20/1000
+    { 6, 2, FIX16(0.37), 754, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 21, drop chance 21/1000
+    { 6, 2, FIX16(0.37), 719, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 22, drop chance 22/1000
+    { 6, 2, FIX16(0.37), 688, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 23, drop chance 23/1000
+    { 6, 2, FIX16(0.37), 659, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 24, drop chance 24/1000
+    { 6, 3, FIX16(0.37), 632, WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 25, drop chance 25/1000
+    { 7, 3, FIX16(0.37), 607, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 26, drop chance 26/1000
+    { 7, 3, FIX16(0.37), 585, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 27, drop chance 27/1000
+    { 7, 3, FIX16(0.37), 563, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 28, drop chance 28/1000
+    { 7, 3, FIX16(0.37), 544, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 29, drop chance 29/1000
+    { 7, 3, FIX16(0.40), 525, WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 30, drop chance 30/1000
+    { 7, 3, FIX16(0.40), 508, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 31, drop chance 31/1000
+    { 7, 3, FIX16(0.40), 492, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 32, drop chance 32/1000
+    { 7, 3, FIX16(0.40), 477, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 33, drop chance 33/1000
+    { 7, 3, FIX16(0.40), 463, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) },  // Wave 34, drop chance 34/1000
+    { 7, 3, FIX16(0.40), 449, WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 35, drop chance 35/1000
+    { 7, 3, FIX16(0.40), 436, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 36, drop chance 36/1000
+    { 7, 3, FIX16(0.40), 424, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 37, drop chance 37/1000
+    { 7, 3, FIX16(0.40), 413, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 38, drop chance 38/1000
+    { 7, 3, FIX16(0.40), 402, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 39, drop chance 39/1000
+    { 7, 3, FIX16(0.45), 392, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 40, drop chance 40/1000
+    { 7, 3, FIX16(0.45), 382, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 41, drop chance 41/1000
+    { 7, 3, FIX16(0.45), 373, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 42, drop chance 42/1000
+    { 7, 3, FIX16(0.45), 364, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 43, drop chance 43/1000
+    { 7, 3, FIX16(0.45), 356, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 44, drop chance 44/1000
+    { 7, 4, FIX16(0.45), 347, WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 45, drop chance 45/1000
+    { 7, 4, FIX16(0.45), 340, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 46, drop chance 46/1000
+    { 7, 4, FIX16(0.45), 332, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 47, drop chance 47/1000
+    { 7, 4, FIX16(0.45), 325, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 48, drop chance 48/1000
+    { 7, 4, FIX16(0.45), 318, 0, (1 << FLIGHT_PATH_LEVEL) | (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 49, drop chance 49/1000
+    { 7, 4, FIX16(0.50), 312, WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 50, drop chance 50/1000
+    { 7, 4, FIX16(0.50), 306, 0, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 51, drop chance 51/1000
+    { 7, 4, FIX16(0.50), 300, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 52, drop chance 52/1000
+    { 7, 4, FIX16(0.50), 294, 0, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 53, drop chance 53/1000
+    { 7, 4, FIX16(0.50), 288, 0, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 54, drop chance 54/1000
+    { 7, 4, FIX16(0.50), 283, WAVE_FLAG_BEAR, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 55, drop chance 55/1000
+    { 7, 4, FIX16(0.50), 278, WAVE_FLAG_TRUCK, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 56, drop chance 56/1000
+    { 7, 4, FIX16(0.50), 273, 0, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 57, drop chance 57/1000
+    { 7, 4, FIX16(0.50), 268, 0, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 58, drop chance 58/1000
+    { 7, 4, FIX16(0.50), 263, 0, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 59, drop chance 59/1000
+    { 7, 4, FIX16(0.50), 259, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 60, drop chance 60/1000
+    { 7, 4, FIX16(0.50), 254, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 61, drop chance 61/1000
+    { 7, 4, FIX16(0.50), 250, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 62, drop chance 62/1000
+    { 7, 4, FIX16(0.50), 246, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 63, drop chance 63/1000
+    { 7, 4, FIX16(0.50), 242, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 64, drop chance 64/1000
+    { 7, 5, FIX16(0.50), 238, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 65, drop chance 65/1000
+    { 7, 5, FIX16(0.50), 234, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 66, drop chance 66/1000
+    { 7, 5, FIX16(0.50), 231, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 67, drop chance 67/1000
+    { 7, 5, FIX16(0.50), 227, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 68, drop chance 68/1000
+    { 7, 5, FIX16(0.50), 224, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 69, drop chance 69/1000
+    { 7, 5, FIX16(0.50), 220, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 70, drop chance 70/1000
+    { 7, 5, FIX16(0.50), 217, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 71, drop chance 71/1000
+    { 7, 5, FIX16(0.50), 214, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 72, drop chance 72/1000
+    { 7, 5, FIX16(0.50), 211, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 73, drop chance 73/1000
+    { 7, 5, FIX16(0.50), 208, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 74, drop chance 74/1000
+    { 7, 5, FIX16(0.50), 205, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 75, drop chance 75/1000
+    { 7, 5, FIX16(0.50), 202, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 76, drop chance 76/1000
+    { 7, 5, FIX16(0.50), 200, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 77, drop chance 77/1000
+    { 7, 5, FIX16(0.50), 197, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 78, drop chance 78/1000
+    { 7, 5, FIX16(0.50), 194, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 79, drop chance 79/1000
+    { 7, 5, FIX16(0.50), 192, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 80, drop chance 80/1000
+    { 7, 5, FIX16(0.50), 189, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 81, drop chance 81/1000
+    { 7, 5, FIX16(0.50), 187, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 82, drop chance 82/1000
+    { 7, 5, FIX16(0.50), 185, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 83, drop chance 83/1000
+    { 7, 5, FIX16(0.50), 182, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 84, drop chance 84/1000
+    { 7, 5, FIX16(0.50), 180, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 85, drop chance 85/1000
+    { 7, 5, FIX16(0.50), 178, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 86, drop chance 86/1000
+    { 7, 5, FIX16(0.50), 176, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 87, drop chance 87/1000
+    { 7, 5, FIX16(0.50), 174, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 88, drop chance 88/1000
+    { 7, 5, FIX16(0.50), 172, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 89, drop chance 89/1000
+    { 7, 5, FIX16(0.50), 170, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 90, drop chance 90/1000
+    { 7, 5, FIX16(0.50), 168, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 91, drop chance 91/1000
+    { 7, 5, FIX16(0.50), 166, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 92, drop chance 92/1000
+    { 7, 5, FIX16(0.50), 164, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 93, drop chance 93/1000
+    { 7, 5, FIX16(0.50), 162, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 94, drop chance 94/1000
+    { 7, 5, FIX16(0.50), 160, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 95, drop chance 95/1000
+    { 7, 5, FIX16(0.50), 159, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 96, drop chance 96/1000
+    { 7, 5, FIX16(0.50), 157, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 97, drop chance 97/1000
+    { 7, 5, FIX16(0.50), 155, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 98, drop chance 98/1000
+    { 7, 5, FIX16(0.50), 153, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 99, drop chance 99/1000
+    { 7, 5, FIX16(0.50), 152, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 100, drop chance 100/1000
+    { 7, 5, FIX16(0.50), 150, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 101, drop chance 101/1000
+    { 7, 5, FIX16(0.50), 149, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 102, drop chance 102/1000
+    { 7, 5, FIX16(0.50), 147, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 103, drop chance 103/1000
+    { 7, 5, FIX16(0.50), 146, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 104, drop chance 104/1000
+    { 7, 5, FIX16(0.50), 144, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 105, drop chance 105/1000
+    { 7, 5, FIX16(0.50), 143, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 106, drop chance 106/1000
+    { 7, 5, FIX16(0.50), 141, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 107, drop chance 107/1000
+    { 7, 5, FIX16(0.50), 140, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 108, drop chance 108/1000
+    { 7, 5, FIX16(0.50), 139, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 109, drop chance 109/1000
+    { 7, 5, FIX16(0.50), 137, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 110, drop chance 110/1000
+    { 7, 5, FIX16(0.50), 136, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 111, drop chance 111/1000
+    { 7, 5, FIX16(0.50), 135, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 112, drop chance 112/1000
+    { 7, 5, FIX16(0.50), 133, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 113, drop chance 113/1000
+    { 7, 5, FIX16(0.50), 132, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 114, drop chance 114/1000
+    { 7, 5, FIX16(0.50), 131, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 115, drop chance 115/1000
+    { 7, 5, FIX16(0.50), 130, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 116, drop chance 116/1000
+    { 7, 5, FIX16(0.50), 129, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 117, drop chance 117/1000
+    { 7, 5, FIX16(0.50), 127, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 118, drop chance 118/1000
+    { 7, 5, FIX16(0.50), 126, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 119, drop chance 119/1000
+    { 7, 5, FIX16(0.50), 125, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 120, drop chance 120/1000
+    { 7, 5, FIX16(0.50), 124, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 121, drop chance 121/1000
+    { 7, 5, FIX16(0.50), 123, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 122, drop chance 122/1000
+    { 7, 5, FIX16(0.50), 122, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 123, drop chance 123/1000
+    { 7, 5, FIX16(0.50), 121, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 124, drop chance 124/1000
+    { 7, 5, FIX16(0.50), 120, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 125, drop chance 125/1000
+    { 7, 5, FIX16(0.50), 119, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 126, drop chance 126/1000
+    { 7, 5, FIX16(0.50), 118, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 127, drop chance 127/1000
+    { 7, 5, FIX16(0.50), 117, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 128, drop chance 128/1000
+    { 7, 5, FIX16(0.50), 116, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 129, drop chance 129/1000
+    { 7, 5, FIX16(0.50), 115, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 130, drop chance 130/1000
+    { 7, 5, FIX16(0.50), 114, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 131, drop chance 131/1000
+    { 7, 5, FIX16(0.50), 113, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 132, drop chance 132/1000
+    { 7, 5, FIX16(0.50), 112, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 133, drop chance 133/1000
+    { 7, 5, FIX16(0.50), 111, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 134, drop chance 134/1000
+    { 7, 5, FIX16(0.50), 110, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 135, drop chance 135/1000
+    { 7, 5, FIX16(0.50), 109, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 136, drop chance 136/1000
+    { 7, 5, FIX16(0.50), 109, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 137, drop chance 137/1000
+    { 7, 5, FIX16(0.50), 108, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 138, drop chance 138/1000
+    { 7, 5, FIX16(0.50), 107, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 139, drop chance 139/1000
+    { 7, 5, FIX16(0.50), 106, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 140, drop chance 140/1000
+    { 7, 5, FIX16(0.50), 105, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 141, drop chance 141/1000
+    { 7, 5, FIX16(0.50), 104, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 142, drop chance 142/1000
+    { 7, 5, FIX16(0.50), 104, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 143, drop chance 143/1000
+    { 7, 5, FIX16(0.50), 103, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 144, drop chance 144/1000
+    { 7, 5, FIX16(0.50), 102, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 145, drop chance 145/1000
+    { 7, 5, FIX16(0.50), 101, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 146, drop chance 146/1000
+    { 7, 5, FIX16(0.50), 101, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 147, drop chance 147/1000
+    { 7, 5, FIX16(0.50), 100, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 148, drop chance 148/1000
+    { 7, 5, FIX16(0.50), 99, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 149, drop chance 149/1000
+    { 7, 5, FIX16(0.50), 98, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 150, drop chance 150/1000
+    { 7, 5, FIX16(0.50), 98, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 151, drop chance 151/1000
+    { 7, 5, FIX16(0.50), 97, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 152, drop chance 152/1000
+    { 7, 5, FIX16(0.50), 96, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 153, drop chance 153/1000
+    { 7, 5, FIX16(0.50), 96, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 154, drop chance 154/1000
+    { 7, 5, FIX16(0.50), 95, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 155, drop chance 155/1000
+    { 7, 5, FIX16(0.50), 94, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 156, drop chance 156/1000
+    { 7, 5, FIX16(0.50), 94, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 157, drop chance 157/1000
+    { 7, 5, FIX16(0.50), 93, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 158, drop chance 158/1000
+    { 7, 5, FIX16(0.50), 92, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 159, drop chance 159/1000
+    { 7, 5, FIX16(0.50), 92, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 160, drop chance 160/1000
+    { 7, 5, FIX16(0.50), 91, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 161, drop chance 161/1000
+    { 7, 5, FIX16(0.50), 91, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 162, drop chance 162/1000
+    { 7, 5, FIX16(0.50), 90, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 163, drop chance 163/1000
+    { 7, 5, FIX16(0.50), 89, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 164, drop chance 164/1000
+    { 7, 5, FIX16(0.50), 89, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 165, drop chance 165/1000
+    { 7, 5, FIX16(0.50), 88, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 166, drop chance 166/1000
+    { 7, 5, FIX16(0.50), 88, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 167, drop chance 167/1000
+    { 7, 5, FIX16(0.50), 87, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 168, drop chance 168/1000
+    { 7, 5, FIX16(0.50), 86, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 169, drop chance 169/1000
+    { 7, 5, FIX16(0.50), 86, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 170, drop chance 170/1000
+    { 7, 5, FIX16(0.50), 85, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 171, drop chance 171/1000
+    { 7, 5, FIX16(0.50), 85, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 172, drop chance 172/1000
+    { 7, 5, FIX16(0.50), 84, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 173, drop chance 173/1000
+    { 7, 5, FIX16(0.50), 84, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 174, drop chance 174/1000
+    { 7, 5, FIX16(0.50), 83, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 175, drop chance 175/1000
+    { 7, 5, FIX16(0.50), 83, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 176, drop chance 176/1000
+    { 7, 5, FIX16(0.50), 82, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 177, drop chance 177/1000
+    { 7, 5, FIX16(0.50), 82, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 178, drop chance 178/1000
+    { 7, 5, FIX16(0.50), 81, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 179, drop chance 179/1000
+    { 7, 5, FIX16(0.50), 81, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 180, drop chance 180/1000
+    { 7, 5, FIX16(0.50), 80, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 181, drop chance 181/1000
+    { 7, 5, FIX16(0.50), 80, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 182, drop chance 182/1000
+    { 7, 5, FIX16(0.50), 79, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 183, drop chance 183/1000
+    { 7, 5, FIX16(0.50), 79, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 184, drop chance 184/1000
+    { 7, 5, FIX16(0.50), 78, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 185, drop chance 185/1000
+    { 7, 5, FIX16(0.50), 78, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 186, drop chance 186/1000
+    { 7, 5, FIX16(0.50), 77, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 187, drop chance 187/1000
+    { 7, 5, FIX16(0.50), 77, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 188, drop chance 188/1000
+    { 7, 5, FIX16(0.50), 76, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 189, drop chance 189/1000
+    { 7, 5, FIX16(0.50), 76, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 190, drop chance 190/1000
+    { 7, 5, FIX16(0.50), 75, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 191, drop chance 191/1000
+    { 7, 5, FIX16(0.50), 75, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 192, drop chance 192/1000
+    { 7, 5, FIX16(0.50), 75, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 193, drop chance 193/1000
+    { 7, 5, FIX16(0.50), 74, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 194, drop chance 194/1000
+    { 7, 5, FIX16(0.50), 74, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 195, drop chance 195/1000
+    { 7, 5, FIX16(0.50), 73, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 196, drop chance 196/1000
+    { 7, 5, FIX16(0.50), 73, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 197, drop chance 197/1000
+    { 7, 5, FIX16(0.50), 73, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 198, drop chance 198/1000
+    { 7, 5, FIX16(0.50), 72, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 199, drop chance 199/1000
+    { 7, 5, FIX16(0.50), 72, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 200, drop chance 200/1000
+    { 7, 5, FIX16(0.50), 71, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 201, drop chance 201/1000
+    { 7, 5, FIX16(0.50), 71, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 202, drop chance 202/1000
+    { 7, 5, FIX16(0.50), 71, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 203, drop chance 203/1000
+    { 7, 5, FIX16(0.50), 70, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 204, drop chance 204/1000
+    { 7, 5, FIX16(0.50), 70, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 205, drop chance 205/1000
+    { 7, 5, FIX16(0.50), 69, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 206, drop chance 206/1000
+    { 7, 5, FIX16(0.50), 69, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 207, drop chance 207/1000
+    { 7, 5, FIX16(0.50), 69, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 208, drop chance 208/1000
+    { 7, 5, FIX16(0.50), 68, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 209, drop chance 209/1000
+    { 7, 5, FIX16(0.50), 68, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 210, drop chance 210/1000
+    { 7, 5, FIX16(0.50), 68, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 211, drop chance 211/1000
+    { 7, 5, FIX16(0.50), 67, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 212, drop chance 212/1000
+    { 7, 5, FIX16(0.50), 67, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 213, drop chance 213/1000
+    { 7, 5, FIX16(0.50), 66, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 214, drop chance 214/1000
+    { 7, 5, FIX16(0.50), 66, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 215, drop chance 215/1000
+    { 7, 5, FIX16(0.50), 66, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 216, drop chance 216/1000
+    { 7, 5, FIX16(0.50), 65, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 217, drop chance 217/1000
+    { 7, 5, FIX16(0.50), 65, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 218, drop chance 218/1000
+    { 7, 5, FIX16(0.50), 65, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 219, drop chance 219/1000
+    { 7, 5, FIX16(0.50), 64, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 220, drop chance 220/1000
+    { 7, 5, FIX16(0.50), 64, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 221, drop chance 221/1000
+    { 7, 5, FIX16(0.50), 64, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 222, drop chance 222/1000
+    { 7, 5, FIX16(0.50), 63, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 223, drop chance 223/1000
+    { 7, 5, FIX16(0.50), 63, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 224, drop chance 224/1000
+    { 7, 5, FIX16(0.50), 63, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 225, drop chance 225/1000
+    { 7, 5, FIX16(0.50), 62, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 226, drop chance 226/1000
+    { 7, 5, FIX16(0.50), 62, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 227, drop chance 227/1000
+    { 7, 5, FIX16(0.50), 62, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 228, drop chance 228/1000
+    { 7, 5, FIX16(0.50), 62, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 229, drop chance 229/1000
+    { 7, 5, FIX16(0.50), 61, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 230, drop chance 230/1000
+    { 7, 5, FIX16(0.50), 61, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 231, drop chance 231/1000
+    { 7, 5, FIX16(0.50), 61, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 232, drop chance 232/1000
+    { 7, 5, FIX16(0.50), 60, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 233, drop chance 233/1000
+    { 7, 5, FIX16(0.50), 60, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 234, drop chance 234/1000
+    { 7, 5, FIX16(0.50), 60, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 235, drop chance 235/1000
+    { 7, 5, FIX16(0.50), 59, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 236, drop chance 236/1000
+    { 7, 5, FIX16(0.50), 59, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 237, drop chance 237/1000
+    { 7, 5, FIX16(0.50), 59, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 238, drop chance 238/1000
+    { 7, 5, FIX16(0.50), 59, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 239, drop chance 239/1000
+    { 7, 5, FIX16(0.50), 58, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 240, drop chance 240/1000
+    { 7, 5, FIX16(0.50), 58, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 241, drop chance 241/1000
+    { 7, 5, FIX16(0.50), 58, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 242, drop chance 242/1000
+    { 7, 5, FIX16(0.50), 57, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 243, drop chance 243/1000
+    { 7, 5, FIX16(0.50), 57, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 244, drop chance 244/1000
+    { 7, 5, FIX16(0.50), 57, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 245, drop chance 245/1000
+    { 7, 5, FIX16(0.50), 57, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 246, drop chance 246/1000
+    { 7, 5, FIX16(0.50), 56, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 247, drop chance 247/1000
+    { 7, 5, FIX16(0.50), 56, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 248, drop chance 248/1000
+    { 7, 5, FIX16(0.50), 56, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 249, drop chance 249/1000
+    { 7, 5, FIX16(0.50), 56, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 250, drop chance 250/1000
+    { 7, 5, FIX16(0.50), 55, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 251, drop chance 251/1000
+    { 7, 5, FIX16(0.50), 55, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 252, drop chance 252/1000
+    { 7, 5, FIX16(0.50), 55, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 253, drop chance 253/1000
+    { 7, 5, FIX16(0.50), 55, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 254, drop chance 254/1000
+    { 7, 5, FIX16(0.50), 54, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 255, drop chance 255/1000
+    { 7, 5, FIX16(0.50), 54, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 256, drop chance 256/1000
+    { 7, 5, FIX16(0.50), 54, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 257, drop chance 257/1000
+    { 7, 5, FIX16(0.50), 54, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 258, drop chance 258/1000
+    { 7, 5, FIX16(0.50), 53, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 259, drop chance 259/1000
+    { 7, 5, FIX16(0.50), 53, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 260, drop chance 260/1000
+    { 7, 5, FIX16(0.50), 53, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 261, drop chance 261/1000
+    { 7, 5, FIX16(0.50), 53, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 262, drop chance 262/1000
+    { 7, 5, FIX16(0.50), 52, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 263, drop chance 263/1000
+    { 7, 5, FIX16(0.50), 52, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 264, drop chance 264/1000
+    { 7, 5, FIX16(0.50), 52, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 265, drop chance 265/1000
+    { 7, 5, FIX16(0.50), 52, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 266, drop chance 266/1000
+    { 7, 5, FIX16(0.50), 52, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 267, drop chance 267/1000
+    { 7, 5, FIX16(0.50), 51, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 268, drop chance 268/1000
+    { 7, 5, FIX16(0.50), 51, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 269, drop chance 269/1000
+    { 7, 5, FIX16(0.50), 51, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 270, drop chance 270/1000
+    { 7, 5, FIX16(0.50), 51, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 271, drop chance 271/1000
+    { 7, 5, FIX16(0.50), 50, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 272, drop chance 272/1000
+    { 7, 5, FIX16(0.50), 50, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 273, drop chance 273/1000
+    { 7, 5, FIX16(0.50), 50, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 274, drop chance 274/1000
+    { 7, 5, FIX16(0.50), 50, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 275, drop chance 275/1000
+    { 7, 5, FIX16(0.50), 50, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 276, drop chance 276/1000
+    { 7, 5, FIX16(0.50), 49, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 277, drop chance 277/1000
+    { 7, 5, FIX16(0.50), 49, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 278, drop chance 278/1000
+    { 7, 5, FIX16(0.50), 49, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 279, drop chance 279/1000
+    { 7, 5, FIX16(0.50), 49, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 280, drop chance 280/1000
+    { 7, 5, FIX16(0.50), 49, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 281, drop chance 281/1000
+    { 7, 5, FIX16(0.50), 48, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 282, drop chance 282/1000
+    { 7, 5, FIX16(0.50), 48, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 283, drop chance 283/1000
+    { 7, 5, FIX16(0.50), 48, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 284, drop chance 284/1000
+    { 7, 5, FIX16(0.50), 48, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 285, drop chance 285/1000
+    { 7, 5, FIX16(0.50), 47, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 286, drop chance 286/1000
+    { 7, 5, FIX16(0.50), 47, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 287, drop chance 287/1000
+    { 7, 5, FIX16(0.50), 47, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 288, drop chance 288/1000
+    { 7, 5, FIX16(0.50), 47, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 289, drop chance 289/1000
+    { 7, 5, FIX16(0.50), 47, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 290, drop chance 290/1000
+    { 7, 5, FIX16(0.50), 47, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 291, drop chance 291/1000
+    { 7, 5, FIX16(0.50), 46, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 292, drop chance 292/1000
+    { 7, 5, FIX16(0.50), 46, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 293, drop chance 293/1000
+    { 7, 5, FIX16(0.50), 46, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 294, drop chance 294/1000
+    { 7, 5, FIX16(0.50), 46, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 295, drop chance 295/1000
+    { 7, 5, FIX16(0.50), 46, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 296, drop chance 296/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 297, drop chance 297/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 298, drop chance 298/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 299, drop chance 299/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_TRUCK | WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 300, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 301, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 302, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 303, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 304, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 305, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 306, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 307, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 308, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 309, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 310, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 311, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 312, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 313, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 314, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_BEAR | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 315, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_TRUCK | WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 316, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 317, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 318, drop chance 300/1000
+    { 7, 5, FIX16(0.50), 45, WAVE_FLAG_AIMED, (1 << FLIGHT_PATH_WEAVE) | (1 << FLIGHT_PATH_SWOOP) | (1 << FLIGHT_PATH_DIVE) },  // Wave 319, drop chance 300/1000
+};
+
+const u16 drop_gap_neglog[DROP_GAP_TABLE_SIZE] =
+{
+    1597, 1316, 1185, 1099, 1035, 983, 940, 904, 872, 843, 818, 794, 773, 753, 735, 718,
+    702, 687, 673, 659, 646, 634, 623, 611, 601, 590, 581, 571, 562, 553, 545, 536,
+    528, 521, 513, 506, 499, 492, 485, 478, 472, 466, 460, 454, 448, 442, 437, 431,
+    426, 421, 416, 411, 406, 401, 396, 391, 387, 382, 378, 374, 369, 365, 361, 357,
+    353, 349, 345, 341, 337, 334, 330, 327, 323, 319, 316, 313, 309, 306, 303, 299,
+    296, 293, 290, 287, 284, 281, 278, 275, 272, 269, 266, 263, 261, 258, 255, 252,
+    250, 247, 245, 242, 239, 237, 234, 232, 229, 227, 225, 222, 220, 217, 215, 213,
+    210, 208, 206, 204, 202, 199, 197, 195, 193, 191, 189, 187, 185, 182, 180, 178,
+    176, 174, 172, 171, 169, 167, 165, 163, 161, 159, 157, 155, 154, 152, 150, 148,
+    146, 145, 143, 141, 139, 138, 136, 134, 133, 131, 129, 128, 126, 124, 123, 121,
+    120, 118, 116, 115, 113, 112, 110, 109, 107, 106, 104, 103, 101, 100, 98, 97,
+    95, 94, 92, 91, 89, 88, 87, 85, 84, 82, 81, 80, 78, 77, 76, 74,
+    73, 72, 70, 69, 68, 66, 65, 64, 63, 61, 60, 59, 58, 56, 55, 54,
+    53, 51, 50, 49, 48, 46, 45, 44, 43, 42, 41, 39, 38, 37, 36, 35,
+    34, 32, 31, 30, 29, 28, 27, 26, 25, 24, 22, 21, 20, 19, 18, 17,
+    16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+};
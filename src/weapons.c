@@ -3,6 +3,12 @@
 #include "resources.h"
 #include "explosions.h"
 #include "scoring.h"
+#include "bcd.h"
+#include "telemetry.h"
+#include "profile.h"
+#include "jobs.h"
+#include "layers.h"
+#include "motion.h"
 
 u8 active_missile_count = 0;
 
@@ -12,7 +18,6 @@ void initWeapons()
     for (u8 i = 0; i < MAX_MISSILES; i++)
     {
         missiles[i].active = FALSE;
-        missiles[i].sprite = NULL;
         missiles[i].type = MISSILE_TYPE_NORMAL;
     }
 }
@@ -23,6 +28,8 @@ void initWeapons()
 static void fireSingleMissileWithAngle(u8 player, s16 cannon_x, s16 crosshair_x, s16 crosshair_y,
                                         fix16 angle_cos, fix16 angle_sin, u8 missile_type)
 {
+    PROF_BEGIN(PROF_FIRE_MISSILE);
+
     // Find an inactive missile slot
     for (u8 i = 0; i < MAX_MISSILES; i++)
     {
@@ -48,6 +55,7 @@ static void fireSingleMissileWithAngle(u8 player, s16 cannon_x, s16 crosshair_x,
             // Safety check
             if (dist_sq == 0)
             {
+                PROF_END(PROF_FIRE_MISSILE);
                 return;
             }
 
@@ -113,32 +121,20 @@ static void fireSingleMissileWithAngle(u8 player, s16 cannon_x, s16 crosshair_x,
             missiles[i].vx = vx_scaled;
             missiles[i].vy = vy_scaled;
 
-            // Create sprite for this missile
-            s16 sprite_x = (s16)(missiles[i].x >> FIX16_FRAC_BITS) - 4;
-            s16 sprite_y = (s16)(missiles[i].y >> FIX16_FRAC_BITS) - 4;
-
-            // Use appropriate sprite based on missile type
-            // For now, use snowball for both (fastshot sprite to be added)
-            missiles[i].sprite = SPR_addSprite(&sprite_snowball,
-                                                sprite_x,
-                                                sprite_y,
-                                                TILE_ATTR(PAL1, 0, FALSE, FALSE));
-
-            // Check if sprite creation failed
-            if (missiles[i].sprite == NULL)
-            {
-                // Sprite creation failed - don't fire
-                return;
-            }
-
+            // No sprite to create: snowballs are drawn by the projectile layer
             missiles[i].active = TRUE;
             missiles[i].player = player;
             missiles[i].type = missile_type;
 
             // Don't decrement ammo here - let fireMissile handle it
+            PROF_END(PROF_FIRE_MISSILE);
             return;
         }
     }
+
+    // No free missile slot
+    telemetryAllocFailed();
+    PROF_END(PROF_FIRE_MISSILE);
 }
 
 void fireMissile(u8 player)
@@ -236,11 +232,11 @@ void fireMissile(u8 player)
     // Decrement ammo once (regardless of triple shot)
     if (player == 1)
     {
-        ammo_p1--;
+        ammo_p1 = bcdDecrement(ammo_p1);
     }
     else
     {
-        ammo_p2--;
+        ammo_p2 = bcdDecrement(ammo_p2);
     }
 }
 
@@ -271,13 +267,6 @@ void updateMissiles()
             if (mx < 0 || mx > SCREEN_WIDTH || my < 0)
             {
                 missiles[i].active = FALSE;
-                SPR_releaseSprite(missiles[i].sprite);
-                missiles[i].sprite = NULL;
-            }
-            else
-            {
-                // Update sprite position
-                SPR_setPosition(missiles[i].sprite, mx - 4, my - 4);
             }
         }
     }
@@ -337,49 +326,24 @@ void triggerMegabomb(u8 player)
     // Decrement megabomb count
     megabombs--;
 
-    u16 points_awarded = 0;
+    u32 points_awarded = 0;  // BCD
 
     // Destroy all active enemies
-    for (u8 i = 0; i < MAX_ENEMIES; i++)
+    for (u8 i = 0; i < enemy_count; i++)
     {
-        if (enemies[i].active)
-        {
-            s16 ex = (s16)(enemies[i].x >> FIX16_FRAC_BITS);
-            s16 ey = (s16)(enemies[i].y >> FIX16_FRAC_BITS);
+        s16 ex = (s16)(getMotionX(&enemies[i].motion) >> FIX16_FRAC_BITS);
+        s16 ey = (s16)(enemies[i].y >> FIX16_FRAC_BITS);
 
-            // Spawn explosion at enemy position
-            spawnExplosion(ex, ey);
+        // Spawn explosion at enemy position
+        spawnExplosion(ex, ey);
 
-            // Destroy enemy
-            enemies[i].active = FALSE;
-            SPR_releaseSprite(enemies[i].sprite);
-            enemies[i].sprite = NULL;
+        // Destroy enemy
+        releaseLayerSprite(&enemies[i].sprite);
 
-            // Award points (100 per enemy)
-            points_awarded += 100;
-        }
-    }
-
-    // Destroy all active large enemies
-    for (u8 i = 0; i < MAX_LARGE_ENEMIES; i++)
-    {
-        if (large_enemies[i].active)
-        {
-            s16 ex = (s16)(large_enemies[i].x >> FIX16_FRAC_BITS);
-            s16 ey = (s16)(large_enemies[i].y >> FIX16_FRAC_BITS);
-
-            // Spawn explosion at large enemy position
-            spawnExplosion(ex, ey);
-
-            // Destroy large enemy
-            large_enemies[i].active = FALSE;
-            SPR_releaseSprite(large_enemies[i].sprite);
-            large_enemies[i].sprite = NULL;
-
-            // Award points (200 per large enemy)
-            points_awarded += 200;
-        }
+        // Award the full points for its type
+        points_awarded = bcdAdd(points_awarded, enemies[i].type->score);
     }
+    enemy_count = 0;
 
     // Destroy all active bombs
     for (u8 i = 0; i < MAX_BOMBS; i++)
@@ -389,25 +353,20 @@ void triggerMegabomb(u8 player)
             s16 bx = (s16)(bombs[i].x >> FIX16_FRAC_BITS);
             s16 by = (s16)(bombs[i].y >> FIX16_FRAC_BITS);
 
-            // Spawn explosion at bomb position
-            spawnExplosion(bx, by);
+            // Spawn explosion at bomb position (cosmetic: skipped under heavy load)
+            spawnCosmeticExplosion(bx, by);
 
             // Destroy bomb
             bombs[i].active = FALSE;
-            SPR_releaseSprite(bombs[i].sprite);
-            bombs[i].sprite = NULL;
 
             // Award points (10 per bomb)
-            points_awarded += 10;
+            points_awarded = bcdAdd(points_awarded, SCORE_BOMB);
         }
     }
 
     // Award total points to the player who used the megabomb
-    if (player == 1)
-        score_p1 += points_awarded;
-    else
-        score_p2 += points_awarded;
+    addScore(player, points_awarded);
 
-    // Check for bonus igloo earned from the points
-    checkBonusIgloo();
+    // Check for bonus igloo earned from the points (deferred to a quiet frame)
+    postJob(checkBonusIgloo, JOB_PRIORITY_NORMAL, JOB_DELAY_GAME);
 }
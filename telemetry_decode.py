@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+"""
+Decode the frame telemetry ring buffer from a Genesis RAM dump or save state.
+
+The game keeps the last 128 frames in a RAM buffer (layout in inc/telemetry.h).
+Dump work RAM from the emulator (or just point this at a save state), then:
+
+    python3 telemetry_decode.py ram.bin
+    python3 telemetry_decode.py ram.bin --csv frames.csv --svg frames.svg
+
+The buffer is found by its "ICTL" magic. Dumps that store RAM as little-endian
+words (e.g. Gens save states) are detected and byte-swapped automatically.
+Use --offset to read it at a known position instead, e.g. the address of
+`telemetry` from out/symbol.txt (0xFFxxxx addresses are taken as offsets into
+a 64KB RAM dump).
+
+Output is a per-wave summary of scanlines spent in each main loop phase,
+plus optional CSV of every frame and an SVG chart of per-phase frame time.
+Only the standard library is needed.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b'ICTL'
+MAGIC_SWAPPED = b'CILT'
+HEADER = struct.Struct('>4sHHHHI')
+RECORD = struct.Struct('>HHBBBBBBBBB9B9HHH')
+NO_MARK = 0xFFFF
+VERSION = 3  # TELEMETRY_VERSION; older dumps label marks and flags differently
+ACTIVE_LINES = 224  # VBlank starts after the last displayed line
+
+FLAG_PAUSED = 0x01
+FLAG_GAME_OVER = 0x02
+FLAG_TITLE = 0x04
+FLAG_PAL = 0x08
+FLAG_THROTTLED = 0x10
+GOVERNOR_SHIFT = 5  # Bits 5-7: quality governor level
+
+# Phase marks in main loop order (TELEMETRY_PHASE_*)
+MARKS = ['start', 'missiles', 'enemies', 'bombs', 'collisions', 'catchup', 'render', 'jobs', 'end']
+
+# Each phase is the time from the previous mark to its own
+PHASES = MARKS[1:]
+PHASE_COLORS = ['#4e79a7', '#f28e2b', '#e15759', '#76b7b2', '#59a14f', '#9c755f', '#edc948', '#b07aa1']
+
+
+def swap_words(data):
+    out = bytearray(data)
+    out[0::2], out[1::2] = data[1::2], data[0::2]
+    return bytes(out)
+
+
+def find_buffer(data, offset=None, swapped=None):
+    """Return (data, offset) with data in big-endian order."""
+    if offset is not None:
+        if offset >= 0xFF0000:
+            offset -= 0xFF0000
+        if swapped is None:
+            swapped = data[offset:offset + 4] == MAGIC_SWAPPED
+        if swapped:
+            data = swap_words(data[:len(data) & ~1])
+        return data, offset
+
+    if not swapped:
+        pos = data.find(MAGIC)
+        while pos >= 0 and pos % 2:
+            pos = data.find(MAGIC, pos + 1)
+        if pos >= 0:
+            return data, pos
+
+    pos = data.find(MAGIC_SWAPPED)
+    while pos >= 0 and pos % 2:
+        pos = data.find(MAGIC_SWAPPED, pos + 1)
+    if pos >= 0:
+        return swap_words(data[:len(data) & ~1]), pos
+
+    raise ValueError('telemetry buffer not found (no "ICTL" magic); try --offset')
+
+
+def read_records(data, offset):
+    magic, version, record_size, count, head, frames = HEADER.unpack_from(data, offset)
+    if magic != MAGIC:
+        raise ValueError(f'bad magic {magic!r} at 0x{offset:X}')
+    if version != VERSION or record_size != RECORD.size:
+        raise ValueError(f'unsupported telemetry version {version} (record size {record_size}); '
+                         f'this decoder reads version {VERSION}')
+
+    base = offset + HEADER.size
+    if frames >= count:
+        order = [(head + i) % count for i in range(count)]
+    else:
+        order = list(range(frames))
+
+    records = []
+    for index in order:
+        fields = RECORD.unpack_from(data, base + index * RECORD.size)
+        records.append({
+            'frame': fields[0],
+            'wave': fields[1],
+            'missiles': fields[2],
+            'enemies': fields[3],
+            'large_enemies': fields[4],
+            'bombs': fields[5],
+            'explosions': fields[6],
+            'sprites': fields[7],
+            'alloc_failures': fields[8],
+            'flags': fields[9],
+            'ticks': fields[10],
+            'vblanks': list(fields[11:20]),
+            'marks': list(fields[20:29]),
+            'dma_bytes': fields[29],
+            'projectile_tiles': fields[30],
+        })
+    return records, frames
+
+
+def frame_lines(record):
+    return 313 if record['flags'] & FLAG_PAL else 262
+
+
+def mark_positions(record):
+    """Each mark as lines since the VBlank before the frame started (None if unmarked).
+
+    The V-counter wraps every frame, so whole frames come from the VBlanks
+    counted since the start mark; a frame that overruns keeps its full length.
+    """
+    total = frame_lines(record)
+    return [None if mark == NO_MARK else vblanks * total + (mark - ACTIVE_LINES) % total
+            for mark, vblanks in zip(record['marks'], record['vblanks'])]
+
+
+def phase_lines(record):
+    """Scanlines spent in each phase (None if the phase didn't run)."""
+    positions = mark_positions(record)
+    result = []
+    last = positions[0]
+    for position in positions[1:]:
+        if position is None or last is None:
+            result.append(None)
+        else:
+            result.append(max(position - last, 0))
+        if position is not None:
+            last = position
+    return result
+
+
+def budget_lines(record):
+    """Scanlines from the start mark until the next VBlank begins."""
+    return (ACTIVE_LINES - record['marks'][0]) % frame_lines(record)
+
+
+def total_lines(record):
+    positions = mark_positions(record)
+    if positions[0] is None or positions[-1] is None:
+        return None
+    return max(positions[-1] - positions[0], 0)
+
+
+def write_csv(path, records):
+    with open(path, 'w') as f:
+        f.write('frame,wave,flags,ticks,missiles,enemies,large_enemies,bombs,explosions,sprites,'
+                'alloc_failures,dma_bytes,projectile_tiles,' +
+                ','.join('lines_' + name for name in PHASES) + ',lines_total\n')
+        for r in records:
+            phases = ['' if p is None else str(p) for p in phase_lines(r)]
+            total = total_lines(r)
+            f.write(','.join(str(r[k]) for k in (
+                'frame', 'wave', 'flags', 'ticks', 'missiles', 'enemies', 'large_enemies', 'bombs',
+                'explosions', 'sprites', 'alloc_failures', 'dma_bytes', 'projectile_tiles')))
+            f.write(',' + ','.join(phases) + ',' + ('' if total is None else str(total)) + '\n')
+
+
+def write_svg(path, records):
+    """Stacked bar per frame, one color per phase, budget line at the frame length."""
+    bar = 6
+    height = 320
+    # Overrun frames can run past a whole frame; keep their bars on the chart
+    tallest = max([320] + [t for t in (total_lines(r) for r in records) if t is not None])
+    scale = height / float(tallest)
+    width = len(records) * bar + 120
+    parts = [f'<svg xmlns="http://www.w3.org/2000/svg" width="{width}" height="{height + 40}" '
+             f'font-family="monospace" font-size="10">']
+    parts.append(f'<rect width="{width}" height="{height + 40}" fill="white"/>')
+
+    last_wave = None
+    for i, r in enumerate(records):
+        x = i * bar
+        y = height
+        for phase, lines in enumerate(phase_lines(r)):
+            if lines:
+                h = lines * scale
+                y -= h
+                parts.append(f'<rect x="{x}" y="{y:.1f}" width="{bar - 1}" height="{h:.1f}" '
+                             f'fill="{PHASE_COLORS[phase]}"/>')
+        if r['wave'] != last_wave:
+            last_wave = r['wave']
+            parts.append(f'<line x1="{x}" y1="0" x2="{x}" y2="{height}" stroke="#999" stroke-dasharray="2,2"/>')
+            parts.append(f'<text x="{x + 2}" y="{height + 12}">W{r["wave"]}</text>')
+
+    budget = frame_lines(records[0]) if records else 262
+    y = height - budget * scale
+    parts.append(f'<line x1="0" y1="{y:.1f}" x2="{len(records) * bar}" y2="{y:.1f}" stroke="black"/>')
+    parts.append(f'<text x="2" y="{y - 2:.1f}">frame ({budget} lines)</text>')
+
+    for phase, name in enumerate(PHASES):
+        ly = 12 + phase * 14
+        lx = len(records) * bar + 10
+        parts.append(f'<rect x="{lx}" y="{ly - 9}" width="10" height="10" fill="{PHASE_COLORS[phase]}"/>')
+        parts.append(f'<text x="{lx + 14}" y="{ly}">{name}</text>')
+
+    parts.append('</svg>')
+    with open(path, 'w') as f:
+        f.write('\n'.join(parts) + '\n')
+
+
+def print_summary(records, frames):
+    print(f'{frames} frames recorded, {len(records)} in buffer')
+    print()
+    print('wave  frames  ' + ' '.join(f'{name[:8]:>8}' for name in PHASES) +
+          '     total   max  over  allocfail  halfrate  gov')
+
+    waves = {}
+    for r in records:
+        if r['flags'] & (FLAG_TITLE | FLAG_PAUSED | FLAG_GAME_OVER):
+            continue
+        waves.setdefault(r['wave'], []).append(r)
+
+    for wave in sorted(waves):
+        rows = waves[wave]
+        sums = [0] * len(PHASES)
+        counts = [0] * len(PHASES)
+        totals = []
+        over = 0
+        for r in rows:
+            for phase, lines in enumerate(phase_lines(r)):
+                if lines is not None:
+                    sums[phase] += lines
+                    counts[phase] += 1
+            total = total_lines(r)
+            if total is not None:
+                totals.append(total)
+                if total > budget_lines(r):
+                    over += 1
+        avgs = [f'{sums[i] / counts[i]:8.1f}' if counts[i] else '       -' for i in range(len(PHASES))]
+        avg_total = sum(totals) / len(totals) if totals else 0
+        max_total = max(totals) if totals else 0
+        failures = sum(r['alloc_failures'] for r in rows)
+        throttled = sum(1 for r in rows if r['flags'] & FLAG_THROTTLED)
+        governor = max(r['flags'] >> GOVERNOR_SHIFT for r in rows)
+        print(f'{wave:4d}  {len(rows):6d}  ' + ' '.join(avgs) +
+              f'  {avg_total:8.1f} {max_total:5d} {over:5d} {failures:10d} {throttled:9d} {governor:4d}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the frame telemetry ring buffer from a RAM dump')
+    parser.add_argument('dump', help='RAM dump or save state')
+    parser.add_argument('--offset', type=lambda v: int(v, 0), help='buffer offset or 0xFFxxxx address')
+    parser.add_argument('--swap', action='store_true', default=None, help='dump stores RAM as little-endian words')
+    parser.add_argument('--csv', help='write every frame to this CSV file')
+    parser.add_argument('--svg', help='write a per-phase frame time chart to this SVG file')
+    args = parser.parse_args()
+
+    data = open(args.dump, 'rb').read()
+    try:
+        data, offset = find_buffer(data, args.offset, args.swap)
+        records, frames = read_records(data, offset)
+    except ValueError as e:
+        print(f'{args.dump}: {e}', file=sys.stderr)
+        return 1
+
+    print_summary(records, frames)
+    if args.csv:
+        write_csv(args.csv, records)
+        print(f'Wrote {args.csv}')
+    if args.svg:
+        write_svg(args.svg, records)
+        print(f'Wrote {args.svg}')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())